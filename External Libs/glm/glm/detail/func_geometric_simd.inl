@@ -96,4 +96,97 @@ namespace detail
 }//namespace detail
 }//namespace glm
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+
+namespace glm{
+namespace detail
+{
+	template <precision P>
+	struct compute_length<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(tvec4<float, P> const & v)
+		{
+			return vgetq_lane_f32(glm_vec4_length(v.data), 0);
+		}
+	};
+
+	template <precision P>
+	struct compute_distance<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(tvec4<float, P> const & p0, tvec4<float, P> const & p1)
+		{
+			return vgetq_lane_f32(glm_vec4_distance(p0.data, p1.data), 0);
+		}
+	};
+
+	template <precision P>
+	struct compute_dot<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(tvec4<float, P> const& x, tvec4<float, P> const& y)
+		{
+			return vgetq_lane_f32(glm_vec1_dot(x.data, y.data), 0);
+		}
+	};
+
+	template <precision P>
+	struct compute_cross<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec3<float, P> call(tvec3<float, P> const & a, tvec3<float, P> const & b)
+		{
+			float const load0[4] = {a.x, a.y, a.z, 0.0f};
+			float const load1[4] = {b.x, b.y, b.z, 0.0f};
+			glm_vec4 const xpd0 = glm_vec4_cross(vld1q_f32(load0), vld1q_f32(load1));
+
+			tvec4<float, P> result(uninitialize);
+			result.data = xpd0;
+			return tvec3<float, P>(result);
+		}
+	};
+
+	template <precision P>
+	struct compute_normalize<float, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
+		{
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_normalize(v.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_faceforward<float, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const& N, tvec4<float, P> const& I, tvec4<float, P> const& Nref)
+		{
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_faceforward(N.data, I.data, Nref.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_reflect<float, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const& I, tvec4<float, P> const& N)
+		{
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_reflect(I.data, N.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_refract<float, P, tvec4, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const& I, tvec4<float, P> const& N, float eta)
+		{
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_refract(I.data, N.data, vdupq_n_f32(eta));
+			return result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH
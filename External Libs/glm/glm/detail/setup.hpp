@@ -89,6 +89,8 @@
 #	define GLM_MESSAGE_ARCH_DISPLAYED
 #	if(GLM_ARCH == GLM_ARCH_PURE)
 #		pragma message("GLM: Platform independent code")
+#	elif(GLM_ARCH == GLM_ARCH_AVX512)
+#		pragma message("GLM: AVX-512 instruction set")
 #	elif(GLM_ARCH == GLM_ARCH_AVX2)
 #		pragma message("GLM: AVX2 instruction set")
 #	elif(GLM_ARCH == GLM_ARCH_AVX)
@@ -579,6 +581,19 @@
 #define GLM_FUNC_DECL GLM_CUDA_FUNC_DECL
 #define GLM_FUNC_QUALIFIER GLM_CUDA_FUNC_DEF GLM_INLINE
 
+// User defines: GLM_FORCE_SIMD_STATIC
+
+// The glm_* kernels of glm/simd get internal linkage: a unit built with its own
+// instruction set flags keeps its own copies even when they are not inlined,
+// instead of the linker picking one unit's copy for every unit.
+#if defined(GLM_FORCE_SIMD_STATIC)
+#	define GLM_SIMD_DECL static
+#	define GLM_SIMD_QUALIFIER static GLM_INLINE
+#else
+#	define GLM_SIMD_DECL GLM_FUNC_DECL
+#	define GLM_SIMD_QUALIFIER GLM_FUNC_QUALIFIER
+#endif//defined(GLM_FORCE_SIMD_STATIC)
+
 ///////////////////////////////////////////////////////////////////////////////////
 // Swizzle operators
 
@@ -478,4 +478,427 @@ namespace detail
 	{}
 }//namespace glm
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+
+#include "../simd/common.h"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_SWIZZLE == GLM_SWIZZLE_ENABLED
+	template <precision P, int E0, int E1, int E2, int E3>
+	struct _swizzle_base1<4, float, P, glm::tvec4, E0,E1,E2,E3, true> : public _swizzle_base0<float, 4>
+	{ 
+		GLM_FUNC_QUALIFIER tvec4<float, P> operator ()()  const
+		{
+			glm_vec4 data = *reinterpret_cast<glm_vec4 const*>(&this->_buffer);
+
+			tvec4<float, P> Result(uninitialize);
+			Result.data = vdupq_laneq_f32(data, E0);
+			Result.data = vcopyq_laneq_f32(Result.data, 1, data, E1);
+			Result.data = vcopyq_laneq_f32(Result.data, 2, data, E2);
+			Result.data = vcopyq_laneq_f32(Result.data, 3, data, E3);
+			return Result;
+		}
+	};
+
+	template <precision P, int E0, int E1, int E2, int E3>
+	struct _swizzle_base1<4, int32, P, glm::tvec4, E0,E1,E2,E3, true> : public _swizzle_base0<int32, 4>
+	{ 
+		GLM_FUNC_QUALIFIER tvec4<int32, P> operator ()()  const
+		{
+			glm_ivec4 data = *reinterpret_cast<glm_ivec4 const*>(&this->_buffer);
+
+			tvec4<int32, P> Result(uninitialize);
+			Result.data = vdupq_laneq_s32(data, E0);
+			Result.data = vcopyq_laneq_s32(Result.data, 1, data, E1);
+			Result.data = vcopyq_laneq_s32(Result.data, 2, data, E2);
+			Result.data = vcopyq_laneq_s32(Result.data, 3, data, E3);
+			return Result;
+		}
+	};
+
+	template <precision P, int E0, int E1, int E2, int E3>
+	struct _swizzle_base1<4, uint32, P, glm::tvec4, E0,E1,E2,E3, true> : public _swizzle_base0<uint32, 4>
+	{ 
+		GLM_FUNC_QUALIFIER tvec4<uint32, P> operator ()()  const
+		{
+			glm_uvec4 data = *reinterpret_cast<glm_uvec4 const*>(&this->_buffer);
+
+			tvec4<uint32, P> Result(uninitialize);
+			Result.data = vdupq_laneq_u32(data, E0);
+			Result.data = vcopyq_laneq_u32(Result.data, 1, data, E1);
+			Result.data = vcopyq_laneq_u32(Result.data, 2, data, E2);
+			Result.data = vcopyq_laneq_u32(Result.data, 3, data, E3);
+			return Result;
+		}
+	};
+#	endif// GLM_SWIZZLE == GLM_SWIZZLE_ENABLED
+
+	template <precision P>
+	struct compute_vec4_add<float, P, true>
+	{
+		static tvec4<float, P> call(tvec4<float, P> const & a, tvec4<float, P> const & b)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = vaddq_f32(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_sub<float, P, true>
+	{
+		static tvec4<float, P> call(tvec4<float, P> const & a, tvec4<float, P> const & b)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = vsubq_f32(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_mul<float, P, true>
+	{
+		static tvec4<float, P> call(tvec4<float, P> const & a, tvec4<float, P> const & b)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = vmulq_f32(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_div<float, P, true>
+	{
+		static tvec4<float, P> call(tvec4<float, P> const & a, tvec4<float, P> const & b)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = vdivq_f32(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <>
+	struct compute_vec4_div<float, aligned_lowp, true>
+	{
+		static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & a, tvec4<float, aligned_lowp> const & b)
+		{
+			tvec4<float, aligned_lowp> Result(uninitialize);
+			Result.data = glm_vec4_div_lowp(a.data, b.data);
+			return Result;
+		}
+	};
+
+	// is_int<T>::value is ~0 for integers, int32 and uint32 are distinct NEON types
+	template <precision P>
+	struct compute_vec4_and<int32, P, ~0, 32, true>
+	{
+		static tvec4<int32, P> call(tvec4<int32, P> const & a, tvec4<int32, P> const & b)
+		{
+			tvec4<int32, P> Result(uninitialize);
+			Result.data = vandq_s32(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_and<uint32, P, ~0, 32, true>
+	{
+		static tvec4<uint32, P> call(tvec4<uint32, P> const & a, tvec4<uint32, P> const & b)
+		{
+			tvec4<uint32, P> Result(uninitialize);
+			Result.data = vandq_u32(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_or<int32, P, ~0, 32, true>
+	{
+		static tvec4<int32, P> call(tvec4<int32, P> const & a, tvec4<int32, P> const & b)
+		{
+			tvec4<int32, P> Result(uninitialize);
+			Result.data = vorrq_s32(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_or<uint32, P, ~0, 32, true>
+	{
+		static tvec4<uint32, P> call(tvec4<uint32, P> const & a, tvec4<uint32, P> const & b)
+		{
+			tvec4<uint32, P> Result(uninitialize);
+			Result.data = vorrq_u32(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_xor<int32, P, ~0, 32, true>
+	{
+		static tvec4<int32, P> call(tvec4<int32, P> const & a, tvec4<int32, P> const & b)
+		{
+			tvec4<int32, P> Result(uninitialize);
+			Result.data = veorq_s32(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_xor<uint32, P, ~0, 32, true>
+	{
+		static tvec4<uint32, P> call(tvec4<uint32, P> const & a, tvec4<uint32, P> const & b)
+		{
+			tvec4<uint32, P> Result(uninitialize);
+			Result.data = veorq_u32(a.data, b.data);
+			return Result;
+		}
+	};
+
+	// per component shifts like the scalar operators, negative counts shift right
+	template <precision P>
+	struct compute_vec4_shift_left<int32, P, ~0, 32, true>
+	{
+		static tvec4<int32, P> call(tvec4<int32, P> const & a, tvec4<int32, P> const & b)
+		{
+			tvec4<int32, P> Result(uninitialize);
+			Result.data = vshlq_s32(a.data, b.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_shift_left<uint32, P, ~0, 32, true>
+	{
+		static tvec4<uint32, P> call(tvec4<uint32, P> const & a, tvec4<uint32, P> const & b)
+		{
+			tvec4<uint32, P> Result(uninitialize);
+			Result.data = vshlq_u32(a.data, vreinterpretq_s32_u32(b.data));
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_shift_right<int32, P, ~0, 32, true>
+	{
+		static tvec4<int32, P> call(tvec4<int32, P> const & a, tvec4<int32, P> const & b)
+		{
+			tvec4<int32, P> Result(uninitialize);
+			Result.data = vshlq_s32(a.data, vnegq_s32(b.data));
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_shift_right<uint32, P, ~0, 32, true>
+	{
+		static tvec4<uint32, P> call(tvec4<uint32, P> const & a, tvec4<uint32, P> const & b)
+		{
+			tvec4<uint32, P> Result(uninitialize);
+			Result.data = vshlq_u32(a.data, vnegq_s32(vreinterpretq_s32_u32(b.data)));
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_bitwise_not<int32, P, ~0, 32, true>
+	{
+		static tvec4<int32, P> call(tvec4<int32, P> const & v)
+		{
+			tvec4<int32, P> Result(uninitialize);
+			Result.data = vmvnq_s32(v.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_bitwise_not<uint32, P, ~0, 32, true>
+	{
+		static tvec4<uint32, P> call(tvec4<uint32, P> const & v)
+		{
+			tvec4<uint32, P> Result(uninitialize);
+			Result.data = vmvnq_u32(v.data);
+			return Result;
+		}
+	};
+
+	// all components equal, the smallest lane of the compare mask is set
+	template <precision P>
+	struct compute_vec4_equal<float, P, false, 32, true>
+	{
+		static bool call(tvec4<float, P> const & v1, tvec4<float, P> const & v2)
+		{
+			return vminvq_u32(vceqq_f32(v1.data, v2.data)) != 0;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_equal<int32, P, ~0, 32, true>
+	{
+		static bool call(tvec4<int32, P> const & v1, tvec4<int32, P> const & v2)
+		{
+			return vminvq_u32(vceqq_s32(v1.data, v2.data)) != 0;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_equal<uint32, P, ~0, 32, true>
+	{
+		static bool call(tvec4<uint32, P> const & v1, tvec4<uint32, P> const & v2)
+		{
+			return vminvq_u32(vceqq_u32(v1.data, v2.data)) != 0;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_nequal<float, P, false, 32, true>
+	{
+		static bool call(tvec4<float, P> const & v1, tvec4<float, P> const & v2)
+		{
+			return vminvq_u32(vceqq_f32(v1.data, v2.data)) == 0;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_nequal<int32, P, ~0, 32, true>
+	{
+		static bool call(tvec4<int32, P> const & v1, tvec4<int32, P> const & v2)
+		{
+			return vminvq_u32(vceqq_s32(v1.data, v2.data)) == 0;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_nequal<uint32, P, ~0, 32, true>
+	{
+		static bool call(tvec4<uint32, P> const & v1, tvec4<uint32, P> const & v2)
+		{
+			return vminvq_u32(vceqq_u32(v1.data, v2.data)) == 0;
+		}
+	};
+}//namespace detail
+
+#	if !GLM_HAS_DEFAULTED_FUNCTIONS
+		template <>
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_lowp>::tvec4()
+#			ifndef GLM_FORCE_NO_CTOR_INIT
+				: data(vdupq_n_f32(0.0f))
+#			endif
+		{}
+
+		template <>
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_mediump>::tvec4()
+#			ifndef GLM_FORCE_NO_CTOR_INIT
+				: data(vdupq_n_f32(0.0f))
+#			endif
+		{}
+
+		template <>
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_highp>::tvec4()
+#			ifndef GLM_FORCE_NO_CTOR_INIT
+				: data(vdupq_n_f32(0.0f))
+#			endif
+		{}
+#	endif//!GLM_HAS_DEFAULTED_FUNCTIONS
+
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_lowp>::tvec4(float s) :
+		data(vdupq_n_f32(s))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_mediump>::tvec4(float s) :
+		data(vdupq_n_f32(s))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_highp>::tvec4(float s) :
+		data(vdupq_n_f32(s))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<int32, aligned_lowp>::tvec4(int32 s) :
+		data(vdupq_n_s32(s))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<int32, aligned_mediump>::tvec4(int32 s) :
+		data(vdupq_n_s32(s))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<int32, aligned_highp>::tvec4(int32 s) :
+		data(vdupq_n_s32(s))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<uint32, aligned_lowp>::tvec4(uint32 s) :
+		data(vdupq_n_u32(s))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<uint32, aligned_mediump>::tvec4(uint32 s) :
+		data(vdupq_n_u32(s))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<uint32, aligned_highp>::tvec4(uint32 s) :
+		data(vdupq_n_u32(s))
+	{}
+
+	// NEON has no set, the lanes are inserted one by one
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_lowp>::tvec4(float a, float b, float c, float d) :
+		data(vsetq_lane_f32(d, vsetq_lane_f32(c, vsetq_lane_f32(b, vdupq_n_f32(a), 1), 2), 3))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_mediump>::tvec4(float a, float b, float c, float d) :
+		data(vsetq_lane_f32(d, vsetq_lane_f32(c, vsetq_lane_f32(b, vdupq_n_f32(a), 1), 2), 3))
+	{}
+
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_highp>::tvec4(float a, float b, float c, float d) :
+		data(vsetq_lane_f32(d, vsetq_lane_f32(c, vsetq_lane_f32(b, vdupq_n_f32(a), 1), 2), 3))
+	{}
+
+	template <>
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<int32, aligned_lowp>::tvec4(int32 a, int32 b, int32 c, int32 d) :
+		data(vsetq_lane_s32(d, vsetq_lane_s32(c, vsetq_lane_s32(b, vdupq_n_s32(a), 1), 2), 3))
+	{}
+
+	template <>
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<int32, aligned_mediump>::tvec4(int32 a, int32 b, int32 c, int32 d) :
+		data(vsetq_lane_s32(d, vsetq_lane_s32(c, vsetq_lane_s32(b, vdupq_n_s32(a), 1), 2), 3))
+	{}
+
+	template <>
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<int32, aligned_highp>::tvec4(int32 a, int32 b, int32 c, int32 d) :
+		data(vsetq_lane_s32(d, vsetq_lane_s32(c, vsetq_lane_s32(b, vdupq_n_s32(a), 1), 2), 3))
+	{}
+
+	template <>
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_lowp>::tvec4(int32 a, int32 b, int32 c, int32 d) :
+		data(vcvtq_f32_s32(vsetq_lane_s32(d, vsetq_lane_s32(c, vsetq_lane_s32(b, vdupq_n_s32(a), 1), 2), 3)))
+	{}
+
+	template <>
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_mediump>::tvec4(int32 a, int32 b, int32 c, int32 d) :
+		data(vcvtq_f32_s32(vsetq_lane_s32(d, vsetq_lane_s32(c, vsetq_lane_s32(b, vdupq_n_s32(a), 1), 2), 3)))
+	{}
+
+	template <>
+	template <>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR_SIMD tvec4<float, aligned_highp>::tvec4(int32 a, int32 b, int32 c, int32 d) :
+		data(vcvtq_f32_s32(vsetq_lane_s32(d, vsetq_lane_s32(c, vsetq_lane_s32(b, vdupq_n_s32(a), 1), 2), 3)))
+	{}
+}//namespace glm
+
+#endif//GLM_ARCH
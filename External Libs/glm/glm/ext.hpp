@@ -60,6 +60,9 @@
 #endif
 
 #include "./gtx/associated_min_max.hpp"
+#include "./gtx/batch_geometric.hpp"
+#include "./gtx/batch_matrix.hpp"
+#include "./gtx/batch_transform.hpp"
 #include "./gtx/bit.hpp"
 #include "./gtx/closest_point.hpp"
 #include "./gtx/color_space.hpp"
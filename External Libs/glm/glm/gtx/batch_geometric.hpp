@@ -0,0 +1,47 @@
+/// @ref gtx_batch_geometric
+/// @file glm/gtx/batch_geometric.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_batch_geometric GLM_GTX_batch_geometric
+/// @ingroup gtx
+///
+/// @brief Dot products and normalization of arrays of vectors.
+///
+/// With AVX-512, single precision vectors are processed 4 per register,
+/// batchNormalize also does 2 per register with AVX; with SSE2 one at a
+/// time. Other types loop over dot and normalize.
+///
+/// <glm/gtx/batch_geometric.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_batch_geometric extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_batch_geometric
+	/// @{
+
+	/// Computes out[i] = dot(a[i], b[i]) for count vectors stored contiguously.
+	///
+	/// @see gtx_batch_geometric
+	template <typename T, precision P>
+	GLM_FUNC_DECL void batchDot(tvec4<T, P> const * a, tvec4<T, P> const * b, T * out, std::size_t count);
+
+	/// Computes out[i] = normalize(in[i]). out may be in.
+	///
+	/// @see gtx_batch_geometric
+	template <typename T, precision P>
+	GLM_FUNC_DECL void batchNormalize(tvec4<T, P> const * in, tvec4<T, P> * out, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "batch_geometric.inl"
@@ -0,0 +1,39 @@
+/// @ref gtx_batch_geometric
+/// @file glm/gtx/batch_geometric.inl
+
+namespace glm{
+namespace detail
+{
+	template <typename T, precision P>
+	struct compute_batchGeometric
+	{
+		GLM_FUNC_QUALIFIER static void dot(tvec4<T, P> const * a, tvec4<T, P> const * b, T * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = glm::dot(a[i], b[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void normalize(tvec4<T, P> const * in, tvec4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = glm::normalize(in[i]);
+		}
+	};
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void batchDot(tvec4<T, P> const * a, tvec4<T, P> const * b, T * out, std::size_t count)
+	{
+		detail::compute_batchGeometric<T, P>::dot(a, b, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void batchNormalize(tvec4<T, P> const * in, tvec4<T, P> * out, std::size_t count)
+	{
+		detail::compute_batchGeometric<T, P>::normalize(in, out, count);
+	}
+}//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE
+#	include "batch_geometric_simd.inl"
+#endif
@@ -0,0 +1,28 @@
+/// @ref gtx_batch_geometric
+/// @file glm/gtx/batch_geometric_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/batch.h"
+
+namespace glm{
+namespace detail
+{
+	// the kernels load unaligned, so any float precision qualifies
+	template <precision P>
+	struct compute_batchGeometric<float, P>
+	{
+		GLM_FUNC_QUALIFIER static void dot(tvec4<float, P> const * a, tvec4<float, P> const * b, float * out, std::size_t count)
+		{
+			glm_vec4_dot_batch(reinterpret_cast<float const*>(a), reinterpret_cast<float const*>(b), out, count);
+		}
+
+		GLM_FUNC_QUALIFIER static void normalize(tvec4<float, P> const * in, tvec4<float, P> * out, std::size_t count)
+		{
+			glm_vec4_normalize_batch(reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,58 @@
+/// @ref gtx_batch_matrix
+/// @file glm/gtx/batch_matrix.hpp
+///
+/// @see core (dependence)
+/// @see gtc_matrix_inverse (dependence)
+///
+/// @defgroup gtx_batch_matrix GLM_GTX_batch_matrix
+/// @ingroup gtx
+///
+/// @brief Products and inverses of arrays of 4x4 matrices, e.g. to propagate world matrices through a scene graph.
+///
+/// With AVX, single precision matrices are processed 8 at a time: they are
+/// transposed so that each register holds the same element of 8 matrices,
+/// computed without shuffles (FMA with AVX2) and transposed back. Other
+/// types and architectures loop over the per matrix functions.
+///
+/// <glm/gtx/batch_matrix.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/matrix_inverse.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_batch_matrix extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_batch_matrix
+	/// @{
+
+	/// Computes out[i] = a[i] * b[i] for count matrices stored contiguously.
+	/// out may be a or b.
+	///
+	/// @see gtx_batch_matrix
+	template <typename T, precision P>
+	GLM_FUNC_DECL void batchMul(tmat4x4<T, P> const * a, tmat4x4<T, P> const * b, tmat4x4<T, P> * out, std::size_t count);
+
+	/// Computes out[i] = inverse(in[i]). out may be in.
+	///
+	/// @see gtx_batch_matrix
+	template <typename T, precision P>
+	GLM_FUNC_DECL void batchInverse(tmat4x4<T, P> const * in, tmat4x4<T, P> * out, std::size_t count);
+
+	/// Computes out[i] = affineInverse(in[i]), the matrices' last row must be
+	/// (0, 0, 0, 1). out may be in.
+	///
+	/// @see gtx_batch_matrix
+	template <typename T, precision P>
+	GLM_FUNC_DECL void batchAffineInverse(tmat4x4<T, P> const * in, tmat4x4<T, P> * out, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "batch_matrix.inl"
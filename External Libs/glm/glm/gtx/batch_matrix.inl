@@ -0,0 +1,51 @@
+/// @ref gtx_batch_matrix
+/// @file glm/gtx/batch_matrix.inl
+
+namespace glm{
+namespace detail
+{
+	template <typename T, precision P>
+	struct compute_batchMatrix
+	{
+		GLM_FUNC_QUALIFIER static void mul(tmat4x4<T, P> const * a, tmat4x4<T, P> const * b, tmat4x4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = a[i] * b[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void inverse(tmat4x4<T, P> const * in, tmat4x4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = glm::inverse(in[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void affineInverse(tmat4x4<T, P> const * in, tmat4x4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = glm::affineInverse(in[i]);
+		}
+	};
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void batchMul(tmat4x4<T, P> const * a, tmat4x4<T, P> const * b, tmat4x4<T, P> * out, std::size_t count)
+	{
+		detail::compute_batchMatrix<T, P>::mul(a, b, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void batchInverse(tmat4x4<T, P> const * in, tmat4x4<T, P> * out, std::size_t count)
+	{
+		detail::compute_batchMatrix<T, P>::inverse(in, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void batchAffineInverse(tmat4x4<T, P> const * in, tmat4x4<T, P> * out, std::size_t count)
+	{
+		detail::compute_batchMatrix<T, P>::affineInverse(in, out, count);
+	}
+}//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE
+#	include "batch_matrix_simd.inl"
+#endif
@@ -0,0 +1,33 @@
+/// @ref gtx_batch_matrix
+/// @file glm/gtx/batch_matrix_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#include "../simd/batch.h"
+
+namespace glm{
+namespace detail
+{
+	// the kernels load unaligned, so any float precision qualifies
+	template <precision P>
+	struct compute_batchMatrix<float, P>
+	{
+		GLM_FUNC_QUALIFIER static void mul(tmat4x4<float, P> const * a, tmat4x4<float, P> const * b, tmat4x4<float, P> * out, std::size_t count)
+		{
+			glm_mat4_mul_batch(reinterpret_cast<float const*>(a), reinterpret_cast<float const*>(b), reinterpret_cast<float*>(out), count);
+		}
+
+		GLM_FUNC_QUALIFIER static void inverse(tmat4x4<float, P> const * in, tmat4x4<float, P> * out, std::size_t count)
+		{
+			glm_mat4_inverse_batch(reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+		}
+
+		GLM_FUNC_QUALIFIER static void affineInverse(tmat4x4<float, P> const * in, tmat4x4<float, P> * out, std::size_t count)
+		{
+			glm_mat4_affine_inverse_batch(reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
@@ -0,0 +1,57 @@
+/// @ref gtx_batch_transform
+/// @file glm/gtx/batch_transform.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_batch_transform GLM_GTX_batch_transform
+/// @ingroup gtx
+///
+/// @brief Transform arrays of vectors by a single matrix.
+///
+/// Single precision arrays use 4 (SSE2), 8 (AVX) or 16 (AVX-512) wide kernels
+/// selected from GLM_ARCH at compile time; other types loop over operator*.
+/// The one matrix per vector version transforms 4 vectors per register with
+/// AVX-512.
+///
+/// <glm/gtx/batch_transform.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_batch_transform extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_batch_transform
+	/// @{
+
+	/// Computes out[i] = m * in[i] for count vectors stored contiguously.
+	/// in and out may be the same array but must not otherwise overlap.
+	///
+	/// @see gtx_batch_transform
+	template <typename T, precision P>
+	GLM_FUNC_DECL void batchTransform(tmat4x4<T, P> const & m, tvec4<T, P> const * in, tvec4<T, P> * out, std::size_t count);
+
+	/// Computes out[i] = m[i] * in[i], one matrix per vector, e.g. for
+	/// instances or skinned vertices. in and out may be the same array.
+	///
+	/// @see gtx_batch_transform
+	template <typename T, precision P>
+	GLM_FUNC_DECL void batchTransform(tmat4x4<T, P> const * m, tvec4<T, P> const * in, tvec4<T, P> * out, std::size_t count);
+
+	/// Structure of arrays version of batchTransform: in[c][i] and out[c][i]
+	/// are the component c (x, y, z, w) of vector i.
+	///
+	/// @see gtx_batch_transform
+	template <typename T, precision P>
+	GLM_FUNC_DECL void batchTransformSoA(tmat4x4<T, P> const & m, T const * const in[4], T * const out[4], std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "batch_transform.inl"
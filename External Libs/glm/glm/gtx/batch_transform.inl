@@ -0,0 +1,57 @@
+/// @ref gtx_batch_transform
+/// @file glm/gtx/batch_transform.inl
+
+namespace glm{
+namespace detail
+{
+	template <typename T, precision P>
+	struct compute_batchTransform
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<T, P> const & m, tvec4<T, P> const * in, tvec4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = m * in[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void call_each(tmat4x4<T, P> const * m, tvec4<T, P> const * in, tvec4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = m[i] * in[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void call_soa(tmat4x4<T, P> const & m, T const * const in[4], T * const out[4], std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				tvec4<T, P> const v = m * tvec4<T, P>(in[0][i], in[1][i], in[2][i], in[3][i]);
+				out[0][i] = v.x;
+				out[1][i] = v.y;
+				out[2][i] = v.z;
+				out[3][i] = v.w;
+			}
+		}
+	};
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void batchTransform(tmat4x4<T, P> const & m, tvec4<T, P> const * in, tvec4<T, P> * out, std::size_t count)
+	{
+		detail::compute_batchTransform<T, P>::call(m, in, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void batchTransform(tmat4x4<T, P> const * m, tvec4<T, P> const * in, tvec4<T, P> * out, std::size_t count)
+	{
+		detail::compute_batchTransform<T, P>::call_each(m, in, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void batchTransformSoA(tmat4x4<T, P> const & m, T const * const in[4], T * const out[4], std::size_t count)
+	{
+		detail::compute_batchTransform<T, P>::call_soa(m, in, out, count);
+	}
+}//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE
+#	include "batch_transform_simd.inl"
+#endif
@@ -0,0 +1,33 @@
+/// @ref gtx_batch_transform
+/// @file glm/gtx/batch_transform_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/batch.h"
+
+namespace glm{
+namespace detail
+{
+	// the kernels load unaligned, so any float precision qualifies
+	template <precision P>
+	struct compute_batchTransform<float, P>
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<float, P> const & m, tvec4<float, P> const * in, tvec4<float, P> * out, std::size_t count)
+		{
+			glm_mat4_mul_vec4_batch(&m[0][0], reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+		}
+
+		GLM_FUNC_QUALIFIER static void call_each(tmat4x4<float, P> const * m, tvec4<float, P> const * in, tvec4<float, P> * out, std::size_t count)
+		{
+			glm_mat4_mul_vec4_batch_each(reinterpret_cast<float const*>(m), reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+		}
+
+		GLM_FUNC_QUALIFIER static void call_soa(tmat4x4<float, P> const & m, float const * const in[4], float * const out[4], std::size_t count)
+		{
+			glm_mat4_mul_vec4_batch_soa(&m[0][0], in, out, count);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,472 @@
+/// @ref simd
+/// @file glm/simd/batch.h
+
+#pragma once
+
+#include "matrix.h"
+#include <cstddef>
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+GLM_SIMD_QUALIFIER __m256 glm_vec8_fma(__m256 a, __m256 b, __m256 c)
+{
+#	if defined(__FMA__) || ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_ARCH & GLM_ARCH_AVX2_BIT))
+		return _mm256_fmadd_ps(a, b, c);
+#	else
+		return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#	endif
+}
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// out[i] = m * in[i] for count tightly packed vec4s. m is a column major
+// mat4, none of the pointers need to be aligned.
+GLM_SIMD_QUALIFIER void glm_mat4_mul_vec4_batch(float const m[16], float const* in, float* out, std::size_t count)
+{
+	std::size_t i = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+		// four vectors per register, the tail is masked
+		__m512 const c0 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 0));
+		__m512 const c1 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 4));
+		__m512 const c2 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 8));
+		__m512 const c3 = _mm512_broadcast_f32x4(_mm_loadu_ps(m + 12));
+
+		for(; i < count; i += 4)
+		{
+			std::size_t const left = count - i;
+			__mmask16 const mask = left >= 4 ? __mmask16(0xffff) : __mmask16((1u << (left * 4)) - 1u);
+
+			__m512 const v = _mm512_maskz_loadu_ps(mask, in + i * 4);
+			__m512 r = _mm512_mul_ps(c0, _mm512_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+			r = _mm512_fmadd_ps(c1, _mm512_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), r);
+			r = _mm512_fmadd_ps(c2, _mm512_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), r);
+			r = _mm512_fmadd_ps(c3, _mm512_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), r);
+			_mm512_mask_storeu_ps(out + i * 4, mask, r);
+		}
+		return;
+#	elif GLM_ARCH & GLM_ARCH_AVX_BIT
+		// two vectors per register
+		__m256 const c0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 0));
+		__m256 const c1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 4));
+		__m256 const c2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 8));
+		__m256 const c3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 12));
+
+		for(; i + 2 <= count; i += 2)
+		{
+			__m256 const v = _mm256_loadu_ps(in + i * 4);
+			__m256 r = _mm256_mul_ps(c0, _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+			r = glm_vec8_fma(c1, _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), r);
+			r = glm_vec8_fma(c2, _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), r);
+			r = glm_vec8_fma(c3, _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), r);
+			_mm256_storeu_ps(out + i * 4, r);
+		}
+#	endif
+
+	glm_vec4 const c[4] = {_mm_loadu_ps(m + 0), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12)};
+	for(; i < count; ++i)
+		_mm_storeu_ps(out + i * 4, glm_mat4_mul_vec4(c, _mm_loadu_ps(in + i * 4)));
+}
+
+// Same product on structure of arrays streams: in[c][i] is component c of
+// vector i. Each register holds one component of 4, 8 or 16 vectors so no
+// shuffles are needed.
+GLM_SIMD_QUALIFIER void glm_mat4_mul_vec4_batch_soa(float const m[16], float const* const in[4], float* const out[4], std::size_t count)
+{
+	std::size_t i = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+		__m512 e[16];
+		for(int j = 0; j < 16; ++j)
+			e[j] = _mm512_set1_ps(m[j]);
+
+		for(; i < count; i += 16)
+		{
+			std::size_t const left = count - i;
+			__mmask16 const mask = left >= 16 ? __mmask16(0xffff) : __mmask16((1u << left) - 1u);
+
+			__m512 const x = _mm512_maskz_loadu_ps(mask, in[0] + i);
+			__m512 const y = _mm512_maskz_loadu_ps(mask, in[1] + i);
+			__m512 const z = _mm512_maskz_loadu_ps(mask, in[2] + i);
+			__m512 const w = _mm512_maskz_loadu_ps(mask, in[3] + i);
+			for(int r = 0; r < 4; ++r)
+			{
+				__m512 a = _mm512_mul_ps(e[r], x);
+				a = _mm512_fmadd_ps(e[4 + r], y, a);
+				a = _mm512_fmadd_ps(e[8 + r], z, a);
+				a = _mm512_fmadd_ps(e[12 + r], w, a);
+				_mm512_mask_storeu_ps(out[r] + i, mask, a);
+			}
+		}
+		return;
+#	elif GLM_ARCH & GLM_ARCH_AVX_BIT
+		__m256 e[16];
+		for(int j = 0; j < 16; ++j)
+			e[j] = _mm256_set1_ps(m[j]);
+
+		for(; i + 8 <= count; i += 8)
+		{
+			__m256 const x = _mm256_loadu_ps(in[0] + i);
+			__m256 const y = _mm256_loadu_ps(in[1] + i);
+			__m256 const z = _mm256_loadu_ps(in[2] + i);
+			__m256 const w = _mm256_loadu_ps(in[3] + i);
+			for(int r = 0; r < 4; ++r)
+			{
+				__m256 a = _mm256_mul_ps(e[r], x);
+				a = glm_vec8_fma(e[4 + r], y, a);
+				a = glm_vec8_fma(e[8 + r], z, a);
+				a = glm_vec8_fma(e[12 + r], w, a);
+				_mm256_storeu_ps(out[r] + i, a);
+			}
+		}
+#	else
+		glm_vec4 e[16];
+		for(int j = 0; j < 16; ++j)
+			e[j] = _mm_set1_ps(m[j]);
+
+		for(; i + 4 <= count; i += 4)
+		{
+			glm_vec4 const x = _mm_loadu_ps(in[0] + i);
+			glm_vec4 const y = _mm_loadu_ps(in[1] + i);
+			glm_vec4 const z = _mm_loadu_ps(in[2] + i);
+			glm_vec4 const w = _mm_loadu_ps(in[3] + i);
+			for(int r = 0; r < 4; ++r)
+			{
+				glm_vec4 const a0 = _mm_add_ps(_mm_mul_ps(e[r], x), _mm_mul_ps(e[4 + r], y));
+				glm_vec4 const a1 = _mm_add_ps(_mm_mul_ps(e[8 + r], z), _mm_mul_ps(e[12 + r], w));
+				_mm_storeu_ps(out[r] + i, _mm_add_ps(a0, a1));
+			}
+		}
+#	endif
+
+	for(; i < count; ++i)
+	{
+		float const x = in[0][i], y = in[1][i], z = in[2][i], w = in[3][i];
+		for(int r = 0; r < 4; ++r)
+			out[r][i] = m[r] * x + m[4 + r] * y + m[8 + r] * z + m[12 + r] * w;
+	}
+}
+
+// out[i] = m[i] * in[i], one matrix per vector (skinning, instancing).
+// With AVX-512 4 matrices are transposed by 128-bit blocks so that a
+// register holds the same column of each.
+GLM_SIMD_QUALIFIER void glm_mat4_mul_vec4_batch_each(float const* m, float const* in, float* out, std::size_t count)
+{
+	std::size_t i = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+		for(; i + 4 <= count; i += 4)
+		{
+			__m512 const m0 = _mm512_loadu_ps(m + i * 16 + 0);
+			__m512 const m1 = _mm512_loadu_ps(m + i * 16 + 16);
+			__m512 const m2 = _mm512_loadu_ps(m + i * 16 + 32);
+			__m512 const m3 = _mm512_loadu_ps(m + i * 16 + 48);
+
+			__m512 const t0 = _mm512_shuffle_f32x4(m0, m1, _MM_SHUFFLE(1, 0, 1, 0));
+			__m512 const t1 = _mm512_shuffle_f32x4(m0, m1, _MM_SHUFFLE(3, 2, 3, 2));
+			__m512 const t2 = _mm512_shuffle_f32x4(m2, m3, _MM_SHUFFLE(1, 0, 1, 0));
+			__m512 const t3 = _mm512_shuffle_f32x4(m2, m3, _MM_SHUFFLE(3, 2, 3, 2));
+			__m512 const c0 = _mm512_shuffle_f32x4(t0, t2, _MM_SHUFFLE(2, 0, 2, 0));
+			__m512 const c1 = _mm512_shuffle_f32x4(t0, t2, _MM_SHUFFLE(3, 1, 3, 1));
+			__m512 const c2 = _mm512_shuffle_f32x4(t1, t3, _MM_SHUFFLE(2, 0, 2, 0));
+			__m512 const c3 = _mm512_shuffle_f32x4(t1, t3, _MM_SHUFFLE(3, 1, 3, 1));
+
+			__m512 const v = _mm512_loadu_ps(in + i * 4);
+			__m512 r = _mm512_mul_ps(c0, _mm512_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+			r = _mm512_fmadd_ps(c1, _mm512_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), r);
+			r = _mm512_fmadd_ps(c2, _mm512_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), r);
+			r = _mm512_fmadd_ps(c3, _mm512_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), r);
+			_mm512_storeu_ps(out + i * 4, r);
+		}
+#	endif
+
+	for(; i < count; ++i)
+	{
+		float const* mi = m + i * 16;
+		glm_vec4 const c[4] = {_mm_loadu_ps(mi + 0), _mm_loadu_ps(mi + 4), _mm_loadu_ps(mi + 8), _mm_loadu_ps(mi + 12)};
+		_mm_storeu_ps(out + i * 4, glm_mat4_mul_vec4(c, _mm_loadu_ps(in + i * 4)));
+	}
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+// sum of each vec4 of a register, in all 4 of its lanes
+GLM_SIMD_QUALIFIER __m512 glm_vec4x4_hadd(__m512 v)
+{
+	__m512 const s0 = _mm512_add_ps(v, _mm512_permute_ps(v, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm512_add_ps(s0, _mm512_permute_ps(s0, _MM_SHUFFLE(1, 0, 3, 2)));
+}
+#endif//GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+// out[i] = dot(a[i], b[i]) for count vec4s
+GLM_SIMD_QUALIFIER void glm_vec4_dot_batch(float const* a, float const* b, float* out, std::size_t count)
+{
+	std::size_t i = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+		for(; i + 4 <= count; i += 4)
+		{
+			__m512 const dot = glm_vec4x4_hadd(_mm512_mul_ps(_mm512_loadu_ps(a + i * 4), _mm512_loadu_ps(b + i * 4)));
+			// lane 0 of each vec4
+			_mm_storeu_ps(out + i, _mm512_castps512_ps128(_mm512_maskz_compress_ps(0x1111, dot)));
+		}
+#	endif
+
+	for(; i < count; ++i)
+		out[i] = _mm_cvtss_f32(glm_vec1_dot(_mm_loadu_ps(a + i * 4), _mm_loadu_ps(b + i * 4)));
+}
+
+// out[i] = normalize(in[i]) for count vec4s, exact square root and division
+GLM_SIMD_QUALIFIER void glm_vec4_normalize_batch(float const* in, float* out, std::size_t count)
+{
+	std::size_t i = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+		for(; i + 4 <= count; i += 4)
+		{
+			__m512 const v = _mm512_loadu_ps(in + i * 4);
+			__m512 const len = _mm512_sqrt_ps(glm_vec4x4_hadd(_mm512_mul_ps(v, v)));
+			_mm512_storeu_ps(out + i * 4, _mm512_div_ps(v, len));
+		}
+#	elif GLM_ARCH & GLM_ARCH_AVX_BIT
+		for(; i + 2 <= count; i += 2)
+		{
+			__m256 const v = _mm256_loadu_ps(in + i * 4);
+			__m256 const p = _mm256_mul_ps(v, v);
+			__m256 const s = _mm256_add_ps(p, _mm256_permute_ps(p, _MM_SHUFFLE(2, 3, 0, 1)));
+			__m256 const dot = _mm256_add_ps(s, _mm256_permute_ps(s, _MM_SHUFFLE(1, 0, 3, 2)));
+			_mm256_storeu_ps(out + i * 4, _mm256_div_ps(v, _mm256_sqrt_ps(dot)));
+		}
+#	endif
+
+	for(; i < count; ++i)
+	{
+		glm_vec4 const v = _mm_loadu_ps(in + i * 4);
+		_mm_storeu_ps(out + i * 4, _mm_div_ps(v, _mm_sqrt_ps(glm_vec4_dot(v, v))));
+	}
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// 8x8 transpose, rows in, columns out
+GLM_SIMD_QUALIFIER void glm_vec8_transpose8(__m256 const in[8], __m256 out[8])
+{
+	__m256 const t0 = _mm256_unpacklo_ps(in[0], in[1]);
+	__m256 const t1 = _mm256_unpackhi_ps(in[0], in[1]);
+	__m256 const t2 = _mm256_unpacklo_ps(in[2], in[3]);
+	__m256 const t3 = _mm256_unpackhi_ps(in[2], in[3]);
+	__m256 const t4 = _mm256_unpacklo_ps(in[4], in[5]);
+	__m256 const t5 = _mm256_unpackhi_ps(in[4], in[5]);
+	__m256 const t6 = _mm256_unpacklo_ps(in[6], in[7]);
+	__m256 const t7 = _mm256_unpackhi_ps(in[6], in[7]);
+
+	__m256 const s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+	__m256 const s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+	__m256 const s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+	__m256 const s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+	__m256 const s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+	out[0] = _mm256_permute2f128_ps(s0, s4, 0x20);
+	out[1] = _mm256_permute2f128_ps(s1, s5, 0x20);
+	out[2] = _mm256_permute2f128_ps(s2, s6, 0x20);
+	out[3] = _mm256_permute2f128_ps(s3, s7, 0x20);
+	out[4] = _mm256_permute2f128_ps(s0, s4, 0x31);
+	out[5] = _mm256_permute2f128_ps(s1, s5, 0x31);
+	out[6] = _mm256_permute2f128_ps(s2, s6, 0x31);
+	out[7] = _mm256_permute2f128_ps(s3, s7, 0x31);
+}
+
+// Loads count (at most 8) consecutive column major mat4s transposed:
+// e[j] holds element j of every matrix. Missing matrices are identity,
+// so they stay harmless for inverses.
+GLM_SIMD_QUALIFIER void glm_mat4x8_load(float const* src, std::size_t count, __m256 e[16])
+{
+	static float const identity[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+
+	__m256 lo[8], hi[8];
+	for(std::size_t i = 0; i < 8; ++i)
+	{
+		float const* m = i < count ? src + i * 16 : identity;
+		lo[i] = _mm256_loadu_ps(m);
+		hi[i] = _mm256_loadu_ps(m + 8);
+	}
+	glm_vec8_transpose8(lo, e);
+	glm_vec8_transpose8(hi, e + 8);
+}
+
+GLM_SIMD_QUALIFIER void glm_mat4x8_store(__m256 const e[16], std::size_t count, float* dst)
+{
+	__m256 lo[8], hi[8];
+	glm_vec8_transpose8(e, lo);
+	glm_vec8_transpose8(e + 8, hi);
+	for(std::size_t i = 0; i < count && i < 8; ++i)
+	{
+		_mm256_storeu_ps(dst + i * 16, lo[i]);
+		_mm256_storeu_ps(dst + i * 16 + 8, hi[i]);
+	}
+}
+
+// out = a * b for 8 matrix pairs in transposed layout
+GLM_SIMD_QUALIFIER void glm_mat4x8_mul(__m256 const a[16], __m256 const b[16], __m256 out[16])
+{
+	for(int c = 0; c < 4; ++c)
+	for(int r = 0; r < 4; ++r)
+	{
+		__m256 s = _mm256_mul_ps(a[r], b[c * 4]);
+		s = glm_vec8_fma(a[4 + r], b[c * 4 + 1], s);
+		s = glm_vec8_fma(a[8 + r], b[c * 4 + 2], s);
+		s = glm_vec8_fma(a[12 + r], b[c * 4 + 3], s);
+		out[c * 4 + r] = s;
+	}
+}
+
+GLM_SIMD_QUALIFIER __m256 glm_vec8_det2(__m256 a, __m256 b, __m256 c, __m256 d)
+{
+	// a * b - c * d
+	return _mm256_sub_ps(_mm256_mul_ps(a, b), _mm256_mul_ps(c, d));
+}
+
+// Inverse of 8 matrices by Laplace expansion over 2x2 sub determinants,
+// no shuffles once the data is transposed. Index 4 * i + j is read as
+// row i, column j: that's the transpose, whose inverse is the transpose
+// of the inverse, so writing the result the same way undoes it.
+GLM_SIMD_QUALIFIER void glm_mat4x8_inverse(__m256 const m[16], __m256 out[16])
+{
+	__m256 const s0 = glm_vec8_det2(m[0], m[5], m[4], m[1]);
+	__m256 const s1 = glm_vec8_det2(m[0], m[6], m[4], m[2]);
+	__m256 const s2 = glm_vec8_det2(m[0], m[7], m[4], m[3]);
+	__m256 const s3 = glm_vec8_det2(m[1], m[6], m[5], m[2]);
+	__m256 const s4 = glm_vec8_det2(m[1], m[7], m[5], m[3]);
+	__m256 const s5 = glm_vec8_det2(m[2], m[7], m[6], m[3]);
+
+	__m256 const c5 = glm_vec8_det2(m[10], m[15], m[14], m[11]);
+	__m256 const c4 = glm_vec8_det2(m[9], m[15], m[13], m[11]);
+	__m256 const c3 = glm_vec8_det2(m[9], m[14], m[13], m[10]);
+	__m256 const c2 = glm_vec8_det2(m[8], m[15], m[12], m[11]);
+	__m256 const c1 = glm_vec8_det2(m[8], m[14], m[12], m[10]);
+	__m256 const c0 = glm_vec8_det2(m[8], m[13], m[12], m[9]);
+
+	__m256 det = _mm256_mul_ps(s0, c5);
+	det = _mm256_sub_ps(det, _mm256_mul_ps(s1, c4));
+	det = glm_vec8_fma(s2, c3, det);
+	det = glm_vec8_fma(s3, c2, det);
+	det = _mm256_sub_ps(det, _mm256_mul_ps(s4, c1));
+	det = glm_vec8_fma(s5, c0, det);
+
+	__m256 const inv = _mm256_div_ps(_mm256_set1_ps(1.0f), det);
+	__m256 const neg = _mm256_sub_ps(_mm256_setzero_ps(), inv);
+
+	// x * p - y * q + z * r, scaled
+#	define GLM_COFACTOR3(x, p, y, q, z, r, scale) \
+		_mm256_mul_ps(glm_vec8_fma(z, r, _mm256_sub_ps(_mm256_mul_ps(x, p), _mm256_mul_ps(y, q))), scale)
+
+	out[0] = GLM_COFACTOR3(m[5], c5, m[6], c4, m[7], c3, inv);
+	out[1] = GLM_COFACTOR3(m[1], c5, m[2], c4, m[3], c3, neg);
+	out[2] = GLM_COFACTOR3(m[13], s5, m[14], s4, m[15], s3, inv);
+	out[3] = GLM_COFACTOR3(m[9], s5, m[10], s4, m[11], s3, neg);
+
+	out[4] = GLM_COFACTOR3(m[4], c5, m[6], c2, m[7], c1, neg);
+	out[5] = GLM_COFACTOR3(m[0], c5, m[2], c2, m[3], c1, inv);
+	out[6] = GLM_COFACTOR3(m[12], s5, m[14], s2, m[15], s1, neg);
+	out[7] = GLM_COFACTOR3(m[8], s5, m[10], s2, m[11], s1, inv);
+
+	out[8] = GLM_COFACTOR3(m[4], c4, m[5], c2, m[7], c0, inv);
+	out[9] = GLM_COFACTOR3(m[0], c4, m[1], c2, m[3], c0, neg);
+	out[10] = GLM_COFACTOR3(m[12], s4, m[13], s2, m[15], s0, inv);
+	out[11] = GLM_COFACTOR3(m[8], s4, m[9], s2, m[11], s0, neg);
+
+	out[12] = GLM_COFACTOR3(m[4], c3, m[5], c1, m[6], c0, neg);
+	out[13] = GLM_COFACTOR3(m[0], c3, m[1], c1, m[2], c0, inv);
+	out[14] = GLM_COFACTOR3(m[12], s3, m[13], s1, m[14], s0, neg);
+	out[15] = GLM_COFACTOR3(m[8], s3, m[9], s1, m[10], s0, inv);
+
+#	undef GLM_COFACTOR3
+}
+
+// Inverse of 8 affine matrices (last row 0, 0, 0, 1): the 3x3 part is
+// inverted by its adjugate and the translation is rotated back.
+GLM_SIMD_QUALIFIER void glm_mat4x8_affine_inverse(__m256 const m[16], __m256 out[16])
+{
+	// element (row r, column c) is m[4 * c + r]
+	__m256 const b00 = glm_vec8_det2(m[5], m[10], m[9], m[6]);
+	__m256 const b01 = glm_vec8_det2(m[8], m[6], m[4], m[10]);
+	__m256 const b02 = glm_vec8_det2(m[4], m[9], m[8], m[5]);
+	__m256 const b10 = glm_vec8_det2(m[9], m[2], m[1], m[10]);
+	__m256 const b11 = glm_vec8_det2(m[0], m[10], m[8], m[2]);
+	__m256 const b12 = glm_vec8_det2(m[8], m[1], m[0], m[9]);
+	__m256 const b20 = glm_vec8_det2(m[1], m[6], m[5], m[2]);
+	__m256 const b21 = glm_vec8_det2(m[4], m[2], m[0], m[6]);
+	__m256 const b22 = glm_vec8_det2(m[0], m[5], m[4], m[1]);
+
+	__m256 det = _mm256_mul_ps(m[0], b00);
+	det = glm_vec8_fma(m[4], b10, det);
+	det = glm_vec8_fma(m[8], b20, det);
+	__m256 const inv = _mm256_div_ps(_mm256_set1_ps(1.0f), det);
+
+	// b_rc is the adjugate's row r, column c
+	out[0] = _mm256_mul_ps(b00, inv);
+	out[1] = _mm256_mul_ps(b10, inv);
+	out[2] = _mm256_mul_ps(b20, inv);
+	out[4] = _mm256_mul_ps(b01, inv);
+	out[5] = _mm256_mul_ps(b11, inv);
+	out[6] = _mm256_mul_ps(b21, inv);
+	out[8] = _mm256_mul_ps(b02, inv);
+	out[9] = _mm256_mul_ps(b12, inv);
+	out[10] = _mm256_mul_ps(b22, inv);
+
+	for(int r = 0; r < 3; ++r)
+	{
+		__m256 t = _mm256_mul_ps(out[r], m[12]);
+		t = glm_vec8_fma(out[4 + r], m[13], t);
+		t = glm_vec8_fma(out[8 + r], m[14], t);
+		out[12 + r] = _mm256_sub_ps(_mm256_setzero_ps(), t);
+	}
+
+	out[3] = out[7] = out[11] = _mm256_setzero_ps();
+	out[15] = _mm256_set1_ps(1.0f);
+}
+
+// out[i] = a[i] * b[i] for count column major mat4s, unaligned; out may
+// be a or b
+GLM_SIMD_QUALIFIER void glm_mat4_mul_batch(float const* a, float const* b, float* out, std::size_t count)
+{
+	for(std::size_t i = 0; i < count; i += 8)
+	{
+		std::size_t const n = count - i < 8 ? count - i : 8;
+		__m256 ea[16], eb[16], eo[16];
+		glm_mat4x8_load(a + i * 16, n, ea);
+		glm_mat4x8_load(b + i * 16, n, eb);
+		glm_mat4x8_mul(ea, eb, eo);
+		glm_mat4x8_store(eo, n, out + i * 16);
+	}
+}
+
+GLM_SIMD_QUALIFIER void glm_mat4_inverse_batch(float const* in, float* out, std::size_t count)
+{
+	for(std::size_t i = 0; i < count; i += 8)
+	{
+		std::size_t const n = count - i < 8 ? count - i : 8;
+		__m256 e[16], eo[16];
+		glm_mat4x8_load(in + i * 16, n, e);
+		glm_mat4x8_inverse(e, eo);
+		glm_mat4x8_store(eo, n, out + i * 16);
+	}
+}
+
+GLM_SIMD_QUALIFIER void glm_mat4_affine_inverse_batch(float const* in, float* out, std::size_t count)
+{
+	for(std::size_t i = 0; i < count; i += 8)
+	{
+		std::size_t const n = count - i < 8 ? count - i : 8;
+		__m256 e[16], eo[16];
+		glm_mat4x8_load(in + i * 16, n, e);
+		glm_mat4x8_affine_inverse(e, eo);
+		glm_mat4x8_store(eo, n, out + i * 16);
+	}
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -7,52 +7,52 @@
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_add(glm_vec4 a, glm_vec4 b)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_add(glm_vec4 a, glm_vec4 b)
 {
 	return _mm_add_ps(a, b);
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec1_add(glm_vec4 a, glm_vec4 b)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec1_add(glm_vec4 a, glm_vec4 b)
 {
 	return _mm_add_ss(a, b);
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sub(glm_vec4 a, glm_vec4 b)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_sub(glm_vec4 a, glm_vec4 b)
 {
 	return _mm_sub_ps(a, b);
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec1_sub(glm_vec4 a, glm_vec4 b)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec1_sub(glm_vec4 a, glm_vec4 b)
 {
 	return _mm_sub_ss(a, b);
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_mul(glm_vec4 a, glm_vec4 b)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_mul(glm_vec4 a, glm_vec4 b)
 {
 	return _mm_mul_ps(a, b);
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec1_mul(glm_vec4 a, glm_vec4 b)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec1_mul(glm_vec4 a, glm_vec4 b)
 {
 	return _mm_mul_ss(a, b);
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_div(glm_vec4 a, glm_vec4 b)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_div(glm_vec4 a, glm_vec4 b)
 {
 	return _mm_div_ps(a, b);
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec1_div(glm_vec4 a, glm_vec4 b)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec1_div(glm_vec4 a, glm_vec4 b)
 {
 	return _mm_div_ss(a, b);
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_div_lowp(glm_vec4 a, glm_vec4 b)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_div_lowp(glm_vec4 a, glm_vec4 b)
 {
 	return glm_vec4_mul(a, _mm_rcp_ps(b));
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_swizzle_xyzw(glm_vec4 a)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_swizzle_xyzw(glm_vec4 a)
 {
 #	if GLM_ARCH & GLM_ARCH_AVX2_BIT
 		return _mm_permute_ps(a, _MM_SHUFFLE(3, 2, 1, 0));
@@ -61,7 +61,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_swizzle_xyzw(glm_vec4 a)
 #	endif
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec1_fma(glm_vec4 a, glm_vec4 b, glm_vec4 c)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec1_fma(glm_vec4 a, glm_vec4 b, glm_vec4 c)
 {
 #	if GLM_ARCH & GLM_ARCH_AVX2_BIT
 		return _mm_fmadd_ss(a, b, c);
@@ -70,7 +70,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec1_fma(glm_vec4 a, glm_vec4 b, glm_vec4 c)
 #	endif
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fma(glm_vec4 a, glm_vec4 b, glm_vec4 c)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_fma(glm_vec4 a, glm_vec4 b, glm_vec4 c)
 {
 #	if GLM_ARCH & GLM_ARCH_AVX2_BIT
 		return _mm_fmadd_ps(a, b, c);
@@ -79,12 +79,12 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fma(glm_vec4 a, glm_vec4 b, glm_vec4 c)
 #	endif
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_abs(glm_vec4 x)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_abs(glm_vec4 x)
 {
 	return _mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF)));
 }
 
-GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_abs(glm_ivec4 x)
+GLM_SIMD_QUALIFIER glm_ivec4 glm_ivec4_abs(glm_ivec4 x)
 {
 #	if GLM_ARCH & GLM_ARCH_SSSE3_BIT
 		return _mm_sign_epi32(x, x);
@@ -96,7 +96,7 @@ GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_abs(glm_ivec4 x)
 #	endif
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sign(glm_vec4 x)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_sign(glm_vec4 x)
 {
 	glm_vec4 const zro0 = _mm_setzero_ps();
 	glm_vec4 const cmp0 = _mm_cmplt_ps(x, zro0);
@@ -107,7 +107,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sign(glm_vec4 x)
 	return or0;
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_round(glm_vec4 x)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_round(glm_vec4 x)
 {
 #	if GLM_ARCH & GLM_ARCH_SSE41_BIT
 		return _mm_round_ps(x, _MM_FROUND_TO_NEAREST_INT);
@@ -121,7 +121,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_round(glm_vec4 x)
 #	endif
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_floor(glm_vec4 x)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_floor(glm_vec4 x)
 {
 #	if GLM_ARCH & GLM_ARCH_SSE41_BIT
 		return _mm_floor_ps(x);
@@ -135,14 +135,14 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_floor(glm_vec4 x)
 }
 
 /* trunc TODO
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_trunc(glm_vec4 x)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_trunc(glm_vec4 x)
 {
 	return glm_vec4();
 }
 */
 
 //roundEven
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_roundEven(glm_vec4 x)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_roundEven(glm_vec4 x)
 {
 	glm_vec4 const sgn0 = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
 	glm_vec4 const and0 = _mm_and_ps(sgn0, x);
@@ -152,7 +152,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_roundEven(glm_vec4 x)
 	return sub0;
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_ceil(glm_vec4 x)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_ceil(glm_vec4 x)
 {
 #	if GLM_ARCH & GLM_ARCH_SSE41_BIT
 		return _mm_ceil_ps(x);
@@ -165,14 +165,14 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_ceil(glm_vec4 x)
 #	endif
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_fract(glm_vec4 x)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_fract(glm_vec4 x)
 {
 	glm_vec4 const flr0 = glm_vec4_floor(x);
 	glm_vec4 const sub0 = glm_vec4_sub(x, flr0);
 	return sub0;
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_mod(glm_vec4 x, glm_vec4 y)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_mod(glm_vec4 x, glm_vec4 y)
 {
 	glm_vec4 const div0 = glm_vec4_div(x, y);
 	glm_vec4 const flr0 = glm_vec4_floor(div0);
@@ -181,14 +181,14 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_mod(glm_vec4 x, glm_vec4 y)
 	return sub0;
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_clamp(glm_vec4 v, glm_vec4 minVal, glm_vec4 maxVal)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_clamp(glm_vec4 v, glm_vec4 minVal, glm_vec4 maxVal)
 {
 	glm_vec4 const min0 = _mm_min_ps(v, maxVal);
 	glm_vec4 const max0 = _mm_max_ps(min0, minVal);
 	return max0;
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_mix(glm_vec4 v1, glm_vec4 v2, glm_vec4 a)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_mix(glm_vec4 v1, glm_vec4 v2, glm_vec4 a)
 {
 	glm_vec4 const sub0 = glm_vec4_sub(_mm_set1_ps(1.0f), a);
 	glm_vec4 const mul0 = glm_vec4_mul(v1, sub0);
@@ -196,13 +196,13 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_mix(glm_vec4 v1, glm_vec4 v2, glm_vec4 a)
 	return mad0;
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_step(glm_vec4 edge, glm_vec4 x)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_step(glm_vec4 edge, glm_vec4 x)
 {
 	glm_vec4 const cmp = _mm_cmple_ps(x, edge);
 	return _mm_movemask_ps(cmp) == 0 ? _mm_set1_ps(1.0f) : _mm_setzero_ps();
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_smoothstep(glm_vec4 edge0, glm_vec4 edge1, glm_vec4 x)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_smoothstep(glm_vec4 edge0, glm_vec4 edge1, glm_vec4 x)
 {
 	glm_vec4 const sub0 = glm_vec4_sub(x, edge0);
 	glm_vec4 const sub1 = glm_vec4_sub(edge1, edge0);
@@ -216,7 +216,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_smoothstep(glm_vec4 edge0, glm_vec4 edge1,
 }
 
 // Agner Fog method
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_nan(glm_vec4 x)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_nan(glm_vec4 x)
 {
 	glm_ivec4 const t1 = _mm_castps_si128(x);						// reinterpret as 32-bit integer
 	glm_ivec4 const t2 = _mm_sll_epi32(t1, _mm_cvtsi32_si128(1));	// shift out sign bit
@@ -230,11 +230,182 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_nan(glm_vec4 x)
 }
 
 // Agner Fog method
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_inf(glm_vec4 x)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_inf(glm_vec4 x)
 {
 	glm_ivec4 const t1 = _mm_castps_si128(x);										// reinterpret as 32-bit integer
 	glm_ivec4 const t2 = _mm_sll_epi32(t1, _mm_cvtsi32_si128(1));					// shift out sign bit
 	return _mm_castsi128_ps(_mm_cmpeq_epi32(t2, _mm_set1_epi32(0xFF000000)));		// exponent is all 1s, fraction is 0
 }
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_add(glm_vec4 a, glm_vec4 b)
+{
+	return vaddq_f32(a, b);
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec1_add(glm_vec4 a, glm_vec4 b)
+{
+	return vsetq_lane_f32(vgetq_lane_f32(a, 0) + vgetq_lane_f32(b, 0), a, 0);
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_sub(glm_vec4 a, glm_vec4 b)
+{
+	return vsubq_f32(a, b);
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec1_sub(glm_vec4 a, glm_vec4 b)
+{
+	return vsetq_lane_f32(vgetq_lane_f32(a, 0) - vgetq_lane_f32(b, 0), a, 0);
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_mul(glm_vec4 a, glm_vec4 b)
+{
+	return vmulq_f32(a, b);
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec1_mul(glm_vec4 a, glm_vec4 b)
+{
+	return vsetq_lane_f32(vgetq_lane_f32(a, 0) * vgetq_lane_f32(b, 0), a, 0);
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_div(glm_vec4 a, glm_vec4 b)
+{
+	return vdivq_f32(a, b);
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec1_div(glm_vec4 a, glm_vec4 b)
+{
+	return vsetq_lane_f32(vgetq_lane_f32(a, 0) / vgetq_lane_f32(b, 0), a, 0);
+}
+
+// the NEON estimate has 8 bits, one Newton-Raphson step brings it close to _mm_rcp_ps
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_div_lowp(glm_vec4 a, glm_vec4 b)
+{
+	glm_vec4 const rcp0 = vrecpeq_f32(b);
+	glm_vec4 const rcp1 = vmulq_f32(rcp0, vrecpsq_f32(b, rcp0));
+	return glm_vec4_mul(a, rcp1);
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_swizzle_xyzw(glm_vec4 a)
+{
+	return a;
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec1_fma(glm_vec4 a, glm_vec4 b, glm_vec4 c)
+{
+	return vsetq_lane_f32(vgetq_lane_f32(vfmaq_f32(c, a, b), 0), a, 0);
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_fma(glm_vec4 a, glm_vec4 b, glm_vec4 c)
+{
+	return vfmaq_f32(c, a, b);
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_abs(glm_vec4 x)
+{
+	return vabsq_f32(x);
+}
+
+GLM_SIMD_QUALIFIER glm_ivec4 glm_ivec4_abs(glm_ivec4 x)
+{
+	return vabsq_s32(x);
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_sign(glm_vec4 x)
+{
+	glm_vec4 const zro0 = vdupq_n_f32(0.0f);
+	glm_vec4 const neg0 = vbslq_f32(vcltq_f32(x, zro0), vdupq_n_f32(-1.0f), zro0);
+	return vbslq_f32(vcgtq_f32(x, zro0), vdupq_n_f32(1.0f), neg0);
+}
+
+// half away from zero, as std::round
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_round(glm_vec4 x)
+{
+	return vrndaq_f32(x);
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_floor(glm_vec4 x)
+{
+	return vrndmq_f32(x);
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_trunc(glm_vec4 x)
+{
+	return vrndq_f32(x);
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_roundEven(glm_vec4 x)
+{
+	return vrndnq_f32(x);
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_ceil(glm_vec4 x)
+{
+	return vrndpq_f32(x);
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_fract(glm_vec4 x)
+{
+	glm_vec4 const flr0 = glm_vec4_floor(x);
+	glm_vec4 const sub0 = glm_vec4_sub(x, flr0);
+	return sub0;
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_mod(glm_vec4 x, glm_vec4 y)
+{
+	glm_vec4 const div0 = glm_vec4_div(x, y);
+	glm_vec4 const flr0 = glm_vec4_floor(div0);
+	glm_vec4 const mul0 = glm_vec4_mul(y, flr0);
+	glm_vec4 const sub0 = glm_vec4_sub(x, mul0);
+	return sub0;
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_clamp(glm_vec4 v, glm_vec4 minVal, glm_vec4 maxVal)
+{
+	glm_vec4 const min0 = vminq_f32(v, maxVal);
+	glm_vec4 const max0 = vmaxq_f32(min0, minVal);
+	return max0;
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_mix(glm_vec4 v1, glm_vec4 v2, glm_vec4 a)
+{
+	glm_vec4 const sub0 = glm_vec4_sub(vdupq_n_f32(1.0f), a);
+	glm_vec4 const mul0 = glm_vec4_mul(v1, sub0);
+	glm_vec4 const mad0 = glm_vec4_fma(v2, a, mul0);
+	return mad0;
+}
+
+// per component, x < edge ? 0 : 1
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_step(glm_vec4 edge, glm_vec4 x)
+{
+	return vbslq_f32(vcltq_f32(x, edge), vdupq_n_f32(0.0f), vdupq_n_f32(1.0f));
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_smoothstep(glm_vec4 edge0, glm_vec4 edge1, glm_vec4 x)
+{
+	glm_vec4 const sub0 = glm_vec4_sub(x, edge0);
+	glm_vec4 const sub1 = glm_vec4_sub(edge1, edge0);
+	glm_vec4 const div0 = glm_vec4_div(sub0, sub1);
+	glm_vec4 const clp0 = glm_vec4_clamp(div0, vdupq_n_f32(0.0f), vdupq_n_f32(1.0f));
+	glm_vec4 const mul0 = glm_vec4_mul(vdupq_n_f32(2.0f), clp0);
+	glm_vec4 const sub2 = glm_vec4_sub(vdupq_n_f32(3.0f), mul0);
+	glm_vec4 const mul1 = glm_vec4_mul(clp0, clp0);
+	glm_vec4 const mul2 = glm_vec4_mul(mul1, sub2);
+	return mul2;
+}
+
+// all bits set where x is NaN, NaN is the only value unequal to itself
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_nan(glm_vec4 x)
+{
+	return vreinterpretq_f32_u32(vmvnq_u32(vceqq_f32(x, x)));
+}
+
+// all bits set where x is +/- infinity
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_inf(glm_vec4 x)
+{
+	glm_uvec4 const abs0 = vreinterpretq_u32_f32(vabsq_f32(x));
+	return vreinterpretq_f32_u32(vceqq_u32(abs0, vdupq_n_u32(0x7F800000)));
+}
+
+#endif//GLM_ARCH
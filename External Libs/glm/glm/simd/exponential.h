@@ -7,14 +7,29 @@
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec1_sqrt_lowp(glm_vec4 x)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec1_sqrt_lowp(glm_vec4 x)
 {
 	return _mm_mul_ss(_mm_rsqrt_ss(x), x);
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sqrt_lowp(glm_vec4 x)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_sqrt_lowp(glm_vec4 x)
 {
 	return _mm_mul_ps(_mm_rsqrt_ps(x), x);
 }
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+
+// the estimate gives 8 bits, one Newton-Raphson step brings it close to _mm_rsqrt_ps
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_sqrt_lowp(glm_vec4 x)
+{
+	glm_vec4 const est0 = vrsqrteq_f32(x);
+	glm_vec4 const est1 = vmulq_f32(est0, vrsqrtsq_f32(vmulq_f32(x, est0), est0));
+	return vmulq_f32(est1, x);
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec1_sqrt_lowp(glm_vec4 x)
+{
+	return vsetq_lane_f32(vgetq_lane_f32(glm_vec4_sqrt_lowp(x), 0), x, 0);
+}
+
+#endif//GLM_ARCH
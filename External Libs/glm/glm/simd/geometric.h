@@ -7,24 +7,24 @@
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
-GLM_FUNC_DECL glm_vec4 glm_vec4_dot(glm_vec4 v1, glm_vec4 v2);
-GLM_FUNC_DECL glm_vec4 glm_vec1_dot(glm_vec4 v1, glm_vec4 v2);
+GLM_SIMD_DECL glm_vec4 glm_vec4_dot(glm_vec4 v1, glm_vec4 v2);
+GLM_SIMD_DECL glm_vec4 glm_vec1_dot(glm_vec4 v1, glm_vec4 v2);
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_length(glm_vec4 x)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_length(glm_vec4 x)
 {
 	glm_vec4 const dot0 = glm_vec4_dot(x, x);
 	glm_vec4 const sqt0 = _mm_sqrt_ps(dot0);
 	return sqt0;
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_distance(glm_vec4 p0, glm_vec4 p1)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_distance(glm_vec4 p0, glm_vec4 p1)
 {
 	glm_vec4 const sub0 = _mm_sub_ps(p0, p1);
 	glm_vec4 const len0 = glm_vec4_length(sub0);
 	return len0;
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_dot(glm_vec4 v1, glm_vec4 v2)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_dot(glm_vec4 v1, glm_vec4 v2)
 {
 #	if GLM_ARCH & GLM_ARCH_AVX_BIT
 		return _mm_dp_ps(v1, v2, 0xff);
@@ -43,7 +43,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_dot(glm_vec4 v1, glm_vec4 v2)
 #	endif
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec1_dot(glm_vec4 v1, glm_vec4 v2)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec1_dot(glm_vec4 v1, glm_vec4 v2)
 {
 #	if GLM_ARCH & GLM_ARCH_AVX_BIT
 		return _mm_dp_ps(v1, v2, 0xff);
@@ -62,7 +62,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec1_dot(glm_vec4 v1, glm_vec4 v2)
 #	endif
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cross(glm_vec4 v1, glm_vec4 v2)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_cross(glm_vec4 v1, glm_vec4 v2)
 {
 	glm_vec4 const swp0 = _mm_shuffle_ps(v1, v1, _MM_SHUFFLE(3, 0, 2, 1));
 	glm_vec4 const swp1 = _mm_shuffle_ps(v1, v1, _MM_SHUFFLE(3, 1, 0, 2));
@@ -74,7 +74,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cross(glm_vec4 v1, glm_vec4 v2)
 	return sub0;
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_normalize(glm_vec4 v)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_normalize(glm_vec4 v)
 {
 	glm_vec4 const dot0 = glm_vec4_dot(v, v);
 	glm_vec4 const isr0 = _mm_rsqrt_ps(dot0);
@@ -82,7 +82,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_normalize(glm_vec4 v)
 	return mul0;
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_faceforward(glm_vec4 N, glm_vec4 I, glm_vec4 Nref)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_faceforward(glm_vec4 N, glm_vec4 I, glm_vec4 Nref)
 {
 	glm_vec4 const dot0 = glm_vec4_dot(Nref, I);
 	glm_vec4 const sgn0 = glm_vec4_sign(dot0);
@@ -91,7 +91,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_faceforward(glm_vec4 N, glm_vec4 I, glm_vec
 	return mul1;
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_reflect(glm_vec4 I, glm_vec4 N)
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_reflect(glm_vec4 I, glm_vec4 N)
 {
 	glm_vec4 const dot0 = glm_vec4_dot(N, I);
 	glm_vec4 const mul0 = _mm_mul_ps(N, dot0);
@@ -100,7 +100,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_reflect(glm_vec4 I, glm_vec4 N)
 	return sub0;
 }
 
-GLM_FUNC_QUALIFIER __m128 glm_vec4_refract(glm_vec4 I, glm_vec4 N, glm_vec4 eta)
+GLM_SIMD_QUALIFIER __m128 glm_vec4_refract(glm_vec4 I, glm_vec4 N, glm_vec4 eta)
 {
 	glm_vec4 const dot0 = glm_vec4_dot(N, I);
 	glm_vec4 const mul0 = _mm_mul_ps(eta, eta);
@@ -121,4 +121,92 @@ GLM_FUNC_QUALIFIER __m128 glm_vec4_refract(glm_vec4 I, glm_vec4 N, glm_vec4 eta)
 	return sub2;
 }
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+
+// pairwise, (x + y) + (z + w) like the scalar dot
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_dot(glm_vec4 v1, glm_vec4 v2)
+{
+	return vdupq_n_f32(vaddvq_f32(vmulq_f32(v1, v2)));
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec1_dot(glm_vec4 v1, glm_vec4 v2)
+{
+	return glm_vec4_dot(v1, v2);
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_length(glm_vec4 x)
+{
+	glm_vec4 const dot0 = glm_vec4_dot(x, x);
+	glm_vec4 const sqt0 = vsqrtq_f32(dot0);
+	return sqt0;
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_distance(glm_vec4 p0, glm_vec4 p1)
+{
+	glm_vec4 const sub0 = vsubq_f32(p0, p1);
+	glm_vec4 const len0 = glm_vec4_length(sub0);
+	return len0;
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_swizzle_yzxw(glm_vec4 v)
+{
+	glm_vec4 const ext0 = vextq_f32(v, v, 1);
+	glm_vec4 const cpy0 = vcopyq_laneq_f32(ext0, 2, v, 0);
+	glm_vec4 const cpy1 = vcopyq_laneq_f32(cpy0, 3, v, 3);
+	return cpy1;
+}
+
+// (v1 * v2.yzx - v1.yzx * v2).yzx, two swizzles less than the SSE form
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_cross(glm_vec4 v1, glm_vec4 v2)
+{
+	glm_vec4 const mul0 = vmulq_f32(v1, glm_vec4_swizzle_yzxw(v2));
+	glm_vec4 const mul1 = vmulq_f32(glm_vec4_swizzle_yzxw(v1), v2);
+	glm_vec4 const sub0 = vsubq_f32(mul0, mul1);
+	return glm_vec4_swizzle_yzxw(sub0);
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_normalize(glm_vec4 v)
+{
+	glm_vec4 const dot0 = glm_vec4_dot(v, v);
+	glm_vec4 const isr0 = vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(dot0));
+	glm_vec4 const mul0 = vmulq_f32(v, isr0);
+	return mul0;
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_faceforward(glm_vec4 N, glm_vec4 I, glm_vec4 Nref)
+{
+	glm_vec4 const dot0 = glm_vec4_dot(Nref, I);
+	uint32x4_t const cmp0 = vcltq_f32(dot0, vdupq_n_f32(0.0f));
+	return vbslq_f32(cmp0, N, vnegq_f32(N));
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_reflect(glm_vec4 I, glm_vec4 N)
+{
+	glm_vec4 const dot0 = glm_vec4_dot(N, I);
+	glm_vec4 const mul0 = vmulq_f32(N, dot0);
+	glm_vec4 const mul1 = vmulq_f32(mul0, vdupq_n_f32(2.0f));
+	glm_vec4 const sub0 = vsubq_f32(I, mul1);
+	return sub0;
+}
+
+// zero on total internal reflection
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_refract(glm_vec4 I, glm_vec4 N, glm_vec4 eta)
+{
+	glm_vec4 const dot0 = glm_vec4_dot(N, I);
+	glm_vec4 const mul0 = vmulq_f32(eta, eta);
+	glm_vec4 const mul1 = vmulq_f32(dot0, dot0);
+	glm_vec4 const sub1 = vsubq_f32(vdupq_n_f32(1.0f), mul1);
+	glm_vec4 const mul2 = vmulq_f32(mul0, sub1);
+	glm_vec4 const sub0 = vsubq_f32(vdupq_n_f32(1.0f), mul2);
+
+	glm_vec4 const sqt0 = vsqrtq_f32(sub0);
+	glm_vec4 const mul3 = vmulq_f32(eta, dot0);
+	glm_vec4 const add0 = vaddq_f32(mul3, sqt0);
+	glm_vec4 const mul4 = vmulq_f32(add0, N);
+	glm_vec4 const mul5 = vmulq_f32(eta, I);
+	glm_vec4 const sub2 = vsubq_f32(mul5, mul4);
+
+	return vbslq_f32(vcgeq_f32(sub0, vdupq_n_f32(0.0f)), sub2, vdupq_n_f32(0.0f));
+}
+
+#endif//GLM_ARCH
@@ -5,7 +5,7 @@
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
-GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_interleave(glm_uvec4 x)
+GLM_SIMD_QUALIFIER glm_uvec4 glm_i128_interleave(glm_uvec4 x)
 {
 	glm_uvec4 const Mask4 = _mm_set1_epi32(0x0000FFFF);
 	glm_uvec4 const Mask3 = _mm_set1_epi32(0x00FF00FF);
@@ -59,7 +59,7 @@ GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_interleave(glm_uvec4 x)
 	return Reg1;
 }
 
-GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_interleave2(glm_uvec4 x, glm_uvec4 y)
+GLM_SIMD_QUALIFIER glm_uvec4 glm_i128_interleave2(glm_uvec4 x, glm_uvec4 y)
 {
 	glm_uvec4 const Mask4 = _mm_set1_epi32(0x0000FFFF);
 	glm_uvec4 const Mask3 = _mm_set1_epi32(0x00FF00FF);
@@ -7,7 +7,7 @@
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
-GLM_FUNC_QUALIFIER void glm_mat4_matrixCompMult(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+GLM_SIMD_QUALIFIER void glm_mat4_matrixCompMult(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
 {
 	out[0] = _mm_mul_ps(in1[0], in2[0]);
 	out[1] = _mm_mul_ps(in1[1], in2[1]);
@@ -15,7 +15,7 @@ GLM_FUNC_QUALIFIER void glm_mat4_matrixCompMult(glm_vec4 const in1[4], glm_vec4
 	out[3] = _mm_mul_ps(in1[3], in2[3]);
 }
 
-GLM_FUNC_QUALIFIER void glm_mat4_add(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+GLM_SIMD_QUALIFIER void glm_mat4_add(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
 {
 	out[0] = _mm_add_ps(in1[0], in2[0]);
 	out[1] = _mm_add_ps(in1[1], in2[1]);
@@ -23,7 +23,7 @@ GLM_FUNC_QUALIFIER void glm_mat4_add(glm_vec4 const in1[4], glm_vec4 const in2[4
 	out[3] = _mm_add_ps(in1[3], in2[3]);
 }
 
-GLM_FUNC_QUALIFIER void glm_mat4_sub(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+GLM_SIMD_QUALIFIER void glm_mat4_sub(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
 {
 	out[0] = _mm_sub_ps(in1[0], in2[0]);
 	out[1] = _mm_sub_ps(in1[1], in2[1]);
@@ -31,7 +31,7 @@ GLM_FUNC_QUALIFIER void glm_mat4_sub(glm_vec4 const in1[4], glm_vec4 const in2[4
 	out[3] = _mm_sub_ps(in1[3], in2[3]);
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_mul_vec4(glm_vec4 const m[4], glm_vec4 v)
+GLM_SIMD_QUALIFIER glm_vec4 glm_mat4_mul_vec4(glm_vec4 const m[4], glm_vec4 v)
 {
 	__m128 v0 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
 	__m128 v1 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
@@ -50,7 +50,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_mul_vec4(glm_vec4 const m[4], glm_vec4 v)
 	return a2;
 }
 
-GLM_FUNC_QUALIFIER __m128 glm_vec4_mul_mat4(glm_vec4 v, glm_vec4 const m[4])
+GLM_SIMD_QUALIFIER __m128 glm_vec4_mul_mat4(glm_vec4 v, glm_vec4 const m[4])
 {
 	__m128 i0 = m[0];
 	__m128 i1 = m[1];
@@ -77,7 +77,7 @@ GLM_FUNC_QUALIFIER __m128 glm_vec4_mul_mat4(glm_vec4 v, glm_vec4 const m[4])
 	return f2;
 }
 
-GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+GLM_SIMD_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
 {
 	{
 		__m128 e0 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(0, 0, 0, 0));
@@ -153,7 +153,7 @@ GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4
 	}
 }
 
-GLM_FUNC_QUALIFIER void glm_mat4_transpose(glm_vec4 const in[4], glm_vec4 out[4])
+GLM_SIMD_QUALIFIER void glm_mat4_transpose(glm_vec4 const in[4], glm_vec4 out[4])
 {
 	__m128 tmp0 = _mm_shuffle_ps(in[0], in[1], 0x44);
 	__m128 tmp2 = _mm_shuffle_ps(in[0], in[1], 0xEE);
@@ -166,7 +166,7 @@ GLM_FUNC_QUALIFIER void glm_mat4_transpose(glm_vec4 const in[4], glm_vec4 out[4]
 	out[3] = _mm_shuffle_ps(tmp2, tmp3, 0xDD);
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_determinant_highp(glm_vec4 const in[4])
+GLM_SIMD_QUALIFIER glm_vec4 glm_mat4_determinant_highp(glm_vec4 const in[4])
 {
 	__m128 Fac0;
 	{
@@ -380,7 +380,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_determinant_highp(glm_vec4 const in[4])
 	return Det0;
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_determinant_lowp(glm_vec4 const m[4])
+GLM_SIMD_QUALIFIER glm_vec4 glm_mat4_determinant_lowp(glm_vec4 const m[4])
 {
 	// _mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(
 
@@ -443,7 +443,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_determinant_lowp(glm_vec4 const m[4])
 	return glm_vec4_dot(m[0], DetCof);
 }
 
-GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_determinant(glm_vec4 const m[4])
+GLM_SIMD_QUALIFIER glm_vec4 glm_mat4_determinant(glm_vec4 const m[4])
 {
 	// _mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(add)
 
@@ -506,7 +506,7 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_determinant(glm_vec4 const m[4])
 	return glm_vec4_dot(m[0], DetCof);
 }
 
-GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
+GLM_SIMD_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 {
 	__m128 Fac0;
 	{
@@ -727,7 +727,7 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
 	out[3] = _mm_mul_ps(Inv3, Rcp0);
 }
 
-GLM_FUNC_QUALIFIER void glm_mat4_inverse_lowp(glm_vec4 const in[4], glm_vec4 out[4])
+GLM_SIMD_QUALIFIER void glm_mat4_inverse_lowp(glm_vec4 const in[4], glm_vec4 out[4])
 {
 	__m128 Fac0;
 	{
@@ -947,7 +947,7 @@ GLM_FUNC_QUALIFIER void glm_mat4_inverse_lowp(glm_vec4 const in[4], glm_vec4 out
 	out[3] = _mm_mul_ps(Inv3, Rcp0);
 }
 /*
-GLM_FUNC_QUALIFIER void glm_mat4_rotate(__m128 const in[4], float Angle, float const v[3], __m128 out[4])
+GLM_SIMD_QUALIFIER void glm_mat4_rotate(__m128 const in[4], float Angle, float const v[3], __m128 out[4])
 {
 	float a = glm::radians(Angle);
 	float c = cos(a);
@@ -1017,7 +1017,7 @@ GLM_FUNC_QUALIFIER void glm_mat4_rotate(__m128 const in[4], float Angle, float c
 	sse_mul_ps(in, Result, out);
 }
 */
-GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const & c, __m128 const & r, __m128 out[4])
+GLM_SIMD_QUALIFIER void glm_mat4_outerProduct(__m128 const & c, __m128 const & r, __m128 out[4])
 {
 	out[0] = _mm_mul_ps(c, _mm_shuffle_ps(r, r, _MM_SHUFFLE(0, 0, 0, 0)));
 	out[1] = _mm_mul_ps(c, _mm_shuffle_ps(r, r, _MM_SHUFFLE(1, 1, 1, 1)));
@@ -1025,4 +1025,196 @@ GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const & c, __m128 const & r
 	out[3] = _mm_mul_ps(c, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
 }
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+
+GLM_SIMD_QUALIFIER void glm_mat4_matrixCompMult(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+	out[0] = vmulq_f32(in1[0], in2[0]);
+	out[1] = vmulq_f32(in1[1], in2[1]);
+	out[2] = vmulq_f32(in1[2], in2[2]);
+	out[3] = vmulq_f32(in1[3], in2[3]);
+}
+
+GLM_SIMD_QUALIFIER void glm_mat4_add(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+	out[0] = vaddq_f32(in1[0], in2[0]);
+	out[1] = vaddq_f32(in1[1], in2[1]);
+	out[2] = vaddq_f32(in1[2], in2[2]);
+	out[3] = vaddq_f32(in1[3], in2[3]);
+}
+
+GLM_SIMD_QUALIFIER void glm_mat4_sub(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+	out[0] = vsubq_f32(in1[0], in2[0]);
+	out[1] = vsubq_f32(in1[1], in2[1]);
+	out[2] = vsubq_f32(in1[2], in2[2]);
+	out[3] = vsubq_f32(in1[3], in2[3]);
+}
+
+// multiplies by lane instead of splatting, the sums keep the SSE order
+GLM_SIMD_QUALIFIER glm_vec4 glm_mat4_mul_vec4(glm_vec4 const m[4], glm_vec4 v)
+{
+	glm_vec4 const m0 = vmulq_laneq_f32(m[0], v, 0);
+	glm_vec4 const m1 = vmulq_laneq_f32(m[1], v, 1);
+	glm_vec4 const m2 = vmulq_laneq_f32(m[2], v, 2);
+	glm_vec4 const m3 = vmulq_laneq_f32(m[3], v, 3);
+
+	glm_vec4 const a0 = vaddq_f32(m0, m1);
+	glm_vec4 const a1 = vaddq_f32(m2, m3);
+	glm_vec4 const a2 = vaddq_f32(a0, a1);
+
+	return a2;
+}
+
+GLM_SIMD_QUALIFIER glm_vec4 glm_vec4_mul_mat4(glm_vec4 v, glm_vec4 const m[4])
+{
+	glm_vec4 const m0 = vmulq_f32(v, m[0]);
+	glm_vec4 const m1 = vmulq_f32(v, m[1]);
+	glm_vec4 const m2 = vmulq_f32(v, m[2]);
+	glm_vec4 const m3 = vmulq_f32(v, m[3]);
+
+	glm_vec4 const a0 = vpaddq_f32(m0, m1);
+	glm_vec4 const a1 = vpaddq_f32(m2, m3);
+	glm_vec4 const a2 = vpaddq_f32(a0, a1);
+
+	return a2;
+}
+
+GLM_SIMD_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+	out[0] = glm_mat4_mul_vec4(in1, in2[0]);
+	out[1] = glm_mat4_mul_vec4(in1, in2[1]);
+	out[2] = glm_mat4_mul_vec4(in1, in2[2]);
+	out[3] = glm_mat4_mul_vec4(in1, in2[3]);
+}
+
+GLM_SIMD_QUALIFIER void glm_mat4_transpose(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	glm_vec4 const tmp0 = vtrn1q_f32(in[0], in[1]);
+	glm_vec4 const tmp1 = vtrn2q_f32(in[0], in[1]);
+	glm_vec4 const tmp2 = vtrn1q_f32(in[2], in[3]);
+	glm_vec4 const tmp3 = vtrn2q_f32(in[2], in[3]);
+
+	out[0] = vcombine_f32(vget_low_f32(tmp0), vget_low_f32(tmp2));
+	out[1] = vcombine_f32(vget_low_f32(tmp1), vget_low_f32(tmp3));
+	out[2] = vcombine_f32(vget_high_f32(tmp0), vget_high_f32(tmp2));
+	out[3] = vcombine_f32(vget_high_f32(tmp1), vget_high_f32(tmp3));
+}
+
+// The 2x2 sub-determinants of the cofactors, laid out like Fac0..Fac5 of the SSE inverse:
+// Fac(i, j) = (m[2][i], m[2][i], m[1][i], m[1][i]) * (m[3][j], m[3][j], m[3][j], m[2][j])
+//           - (m[3][i], m[3][i], m[3][i], m[2][i]) * (m[2][j], m[2][j], m[1][j], m[1][j])
+// Lane indices have to be immediates, the swizzles are spelled out per row.
+#define GLM_NEON_SWZ_A(m, i) vcombine_f32(vdup_laneq_f32(m[2], i), vdup_laneq_f32(m[1], i))
+#define GLM_NEON_SWZ_B(m, i) vcopyq_laneq_f32(vdupq_laneq_f32(m[3], i), 3, m[2], i)
+#define GLM_NEON_SWZ_VEC(m, i) vcopyq_laneq_f32(vdupq_laneq_f32(m[0], i), 0, m[1], i)
+#define GLM_NEON_FAC(i, j) vsubq_f32(vmulq_f32(SwpA##i, SwpB##j), vmulq_f32(SwpB##i, SwpA##j))
+
+// Only the first column of the adjugate, m * adj(m) = det(m) * I
+GLM_SIMD_QUALIFIER glm_vec4 glm_mat4_determinant(glm_vec4 const m[4])
+{
+	glm_vec4 const SwpA1 = GLM_NEON_SWZ_A(m, 1);
+	glm_vec4 const SwpA2 = GLM_NEON_SWZ_A(m, 2);
+	glm_vec4 const SwpA3 = GLM_NEON_SWZ_A(m, 3);
+	glm_vec4 const SwpB1 = GLM_NEON_SWZ_B(m, 1);
+	glm_vec4 const SwpB2 = GLM_NEON_SWZ_B(m, 2);
+	glm_vec4 const SwpB3 = GLM_NEON_SWZ_B(m, 3);
+
+	glm_vec4 const Fac0 = GLM_NEON_FAC(2, 3);
+	glm_vec4 const Fac1 = GLM_NEON_FAC(1, 3);
+	glm_vec4 const Fac2 = GLM_NEON_FAC(1, 2);
+
+	glm_vec4 const Mul00 = vmulq_f32(GLM_NEON_SWZ_VEC(m, 1), Fac0);
+	glm_vec4 const Mul01 = vmulq_f32(GLM_NEON_SWZ_VEC(m, 2), Fac1);
+	glm_vec4 const Mul02 = vmulq_f32(GLM_NEON_SWZ_VEC(m, 3), Fac2);
+	glm_vec4 const Add00 = vaddq_f32(vsubq_f32(Mul00, Mul01), Mul02);
+
+	// m[0][0], -m[1][0], m[2][0], -m[3][0], the + - + - of the column folded in
+	glm_vec4 const Row0 = vcombine_f32(
+		vget_low_f32(vtrn1q_f32(m[0], vnegq_f32(m[1]))),
+		vget_low_f32(vtrn1q_f32(m[2], vnegq_f32(m[3]))));
+
+	return glm_vec4_dot(Row0, Add00);
+}
+
+GLM_SIMD_QUALIFIER void glm_mat4_inverse(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	glm_vec4 const SwpA0 = GLM_NEON_SWZ_A(in, 0);
+	glm_vec4 const SwpA1 = GLM_NEON_SWZ_A(in, 1);
+	glm_vec4 const SwpA2 = GLM_NEON_SWZ_A(in, 2);
+	glm_vec4 const SwpA3 = GLM_NEON_SWZ_A(in, 3);
+	glm_vec4 const SwpB0 = GLM_NEON_SWZ_B(in, 0);
+	glm_vec4 const SwpB1 = GLM_NEON_SWZ_B(in, 1);
+	glm_vec4 const SwpB2 = GLM_NEON_SWZ_B(in, 2);
+	glm_vec4 const SwpB3 = GLM_NEON_SWZ_B(in, 3);
+
+	glm_vec4 const Fac0 = GLM_NEON_FAC(2, 3);
+	glm_vec4 const Fac1 = GLM_NEON_FAC(1, 3);
+	glm_vec4 const Fac2 = GLM_NEON_FAC(1, 2);
+	glm_vec4 const Fac3 = GLM_NEON_FAC(0, 3);
+	glm_vec4 const Fac4 = GLM_NEON_FAC(0, 2);
+	glm_vec4 const Fac5 = GLM_NEON_FAC(0, 1);
+
+	// m[1][i], m[0][i], m[0][i], m[0][i]
+	glm_vec4 const Vec0 = GLM_NEON_SWZ_VEC(in, 0);
+	glm_vec4 const Vec1 = GLM_NEON_SWZ_VEC(in, 1);
+	glm_vec4 const Vec2 = GLM_NEON_SWZ_VEC(in, 2);
+	glm_vec4 const Vec3 = GLM_NEON_SWZ_VEC(in, 3);
+
+	// loaded rather than brace initialized, MSVC's float32x4_t is a union led by integers
+	static float const SignData[5] = {-1.0f, 1.0f,-1.0f, 1.0f,-1.0f};
+	glm_vec4 const SignA = vld1q_f32(SignData);
+	glm_vec4 const SignB = vld1q_f32(SignData + 1);
+
+	// col0
+	glm_vec4 const Mul00 = vmulq_f32(Vec1, Fac0);
+	glm_vec4 const Mul01 = vmulq_f32(Vec2, Fac1);
+	glm_vec4 const Mul02 = vmulq_f32(Vec3, Fac2);
+	glm_vec4 const Inv0 = vmulq_f32(SignB, vaddq_f32(vsubq_f32(Mul00, Mul01), Mul02));
+
+	// col1
+	glm_vec4 const Mul03 = vmulq_f32(Vec0, Fac0);
+	glm_vec4 const Mul04 = vmulq_f32(Vec2, Fac3);
+	glm_vec4 const Mul05 = vmulq_f32(Vec3, Fac4);
+	glm_vec4 const Inv1 = vmulq_f32(SignA, vaddq_f32(vsubq_f32(Mul03, Mul04), Mul05));
+
+	// col2
+	glm_vec4 const Mul06 = vmulq_f32(Vec0, Fac1);
+	glm_vec4 const Mul07 = vmulq_f32(Vec1, Fac3);
+	glm_vec4 const Mul08 = vmulq_f32(Vec3, Fac5);
+	glm_vec4 const Inv2 = vmulq_f32(SignB, vaddq_f32(vsubq_f32(Mul06, Mul07), Mul08));
+
+	// col3
+	glm_vec4 const Mul09 = vmulq_f32(Vec0, Fac2);
+	glm_vec4 const Mul10 = vmulq_f32(Vec1, Fac4);
+	glm_vec4 const Mul11 = vmulq_f32(Vec2, Fac5);
+	glm_vec4 const Inv3 = vmulq_f32(SignA, vaddq_f32(vsubq_f32(Mul09, Mul10), Mul11));
+
+	// Inv0[0], Inv1[0], Inv2[0], Inv3[0]
+	glm_vec4 const Row0 = vcombine_f32(
+		vget_low_f32(vzip1q_f32(Inv0, Inv1)),
+		vget_low_f32(vzip1q_f32(Inv2, Inv3)));
+
+	glm_vec4 const Det0 = glm_vec4_dot(in[0], Row0);
+	glm_vec4 const Rcp0 = vdivq_f32(vdupq_n_f32(1.0f), Det0);
+
+	out[0] = vmulq_f32(Inv0, Rcp0);
+	out[1] = vmulq_f32(Inv1, Rcp0);
+	out[2] = vmulq_f32(Inv2, Rcp0);
+	out[3] = vmulq_f32(Inv3, Rcp0);
+}
+
+#undef GLM_NEON_FAC
+#undef GLM_NEON_SWZ_VEC
+#undef GLM_NEON_SWZ_B
+#undef GLM_NEON_SWZ_A
+
+GLM_SIMD_QUALIFIER void glm_mat4_outerProduct(glm_vec4 const & c, glm_vec4 const & r, glm_vec4 out[4])
+{
+	out[0] = vmulq_laneq_f32(c, r, 0);
+	out[1] = vmulq_laneq_f32(c, r, 1);
+	out[2] = vmulq_laneq_f32(c, r, 2);
+	out[3] = vmulq_laneq_f32(c, r, 3);
+}
+
+#endif//GLM_ARCH
@@ -300,7 +300,8 @@
 ///////////////////////////////////////////////////////////////////////////////////
 // Instruction sets
 
-// User defines: GLM_FORCE_PURE GLM_FORCE_SSE2 GLM_FORCE_SSE3 GLM_FORCE_AVX GLM_FORCE_AVX2 GLM_FORCE_AVX2
+// User defines: GLM_FORCE_PURE GLM_FORCE_SSE2 GLM_FORCE_SSE3 GLM_FORCE_AVX GLM_FORCE_AVX2 GLM_FORCE_AVX512
+// GLM_FORCE_NEON (AArch64, ARMv7 NEON lacks the division, square root and rounding the kernels use)
 
 #define GLM_ARCH_X86_BIT		0x00000001
 #define GLM_ARCH_SSE2_BIT		0x00000002
@@ -311,8 +312,8 @@
 #define GLM_ARCH_AVX_BIT		0x00000040
 #define GLM_ARCH_AVX2_BIT		0x00000080
 #define GLM_ARCH_AVX512_BIT		0x00000100 // Skylake subset
-#define GLM_ARCH_ARM_BIT		0x00000100
-#define GLM_ARCH_NEON_BIT		0x00000200
+#define GLM_ARCH_ARM_BIT		0x00000200
+#define GLM_ARCH_NEON_BIT		0x00000400
 #define GLM_ARCH_MIPS_BIT		0x00010000
 #define GLM_ARCH_PPC_BIT		0x01000000
 
@@ -375,9 +376,9 @@
 #		define GLM_ARCH (GLM_ARCH_SSE2)
 #	elif defined(__i386__) || defined(__x86_64__)
 #		define GLM_ARCH (GLM_ARCH_X86)
-#	elif defined(__ARM_NEON)
+#	elif defined(__ARM_NEON) && defined(__aarch64__)
 #		define GLM_ARCH (GLM_ARCH_ARM | GLM_ARCH_NEON)
-#	elif defined(__arm__ )
+#	elif defined(__arm__ ) || defined(__aarch64__)
 #		define GLM_ARCH (GLM_ARCH_ARM)
 #	elif defined(__mips__ )
 #		define GLM_ARCH (GLM_ARCH_MIPS)
@@ -387,8 +388,12 @@
 #		define GLM_ARCH (GLM_ARCH_PURE)
 #	endif
 #elif (GLM_COMPILER & GLM_COMPILER_VC) || ((GLM_COMPILER & GLM_COMPILER_INTEL) && (GLM_PLATFORM & GLM_PLATFORM_WINDOWS))
-#	if defined(_M_ARM)
+#	if defined(_M_ARM64)
+#		define GLM_ARCH (GLM_ARCH_NEON)
+#	elif defined(_M_ARM)
 #		define GLM_ARCH (GLM_ARCH_ARM)
+#	elif defined(__AVX512BW__) && defined(__AVX512F__) && defined(__AVX512CD__) && defined(__AVX512VL__) && defined(__AVX512DQ__)
+#		define GLM_ARCH (GLM_ARCH_AVX512)
 #	elif defined(__AVX2__)
 #		define GLM_ARCH (GLM_ARCH_AVX2)
 #	elif defined(__AVX__)
@@ -434,12 +439,18 @@
 #	include <pmmintrin.h>
 #elif GLM_ARCH & GLM_ARCH_SSE2_BIT
 #	include <emmintrin.h>
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+#	include <arm_neon.h>
 #endif//GLM_ARCH
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 	typedef __m128		glm_vec4;
 	typedef __m128i		glm_ivec4;
 	typedef __m128i		glm_uvec4;
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+	typedef float32x4_t	glm_vec4;
+	typedef int32x4_t	glm_ivec4;
+	typedef uint32x4_t	glm_uvec4;
 #endif
 
 #if GLM_ARCH & GLM_ARCH_AVX_BIT
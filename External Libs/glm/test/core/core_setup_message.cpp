@@ -204,6 +204,8 @@ int test_instruction_set()
 		std::printf("ARM ");
 	if(GLM_ARCH & GLM_ARCH_NEON_BIT)
 		std::printf("NEON ");
+	if(GLM_ARCH & GLM_ARCH_AVX512_BIT)
+		std::printf("AVX512 ");
 	if(GLM_ARCH & GLM_ARCH_AVX2)
 		std::printf("AVX2 ");
 	if(GLM_ARCH & GLM_ARCH_AVX)
@@ -221,6 +223,10 @@ int test_instruction_set()
 
 	std::printf("\n");
 
+	// every bit belongs to one architecture family
+	Error += (GLM_ARCH & GLM_ARCH_X86_BIT) && (GLM_ARCH & (GLM_ARCH_ARM_BIT | GLM_ARCH_NEON_BIT)) ? 1 : 0;
+	Error += (GLM_ARCH_AVX512_BIT & (GLM_ARCH_ARM_BIT | GLM_ARCH_NEON_BIT)) ? 1 : 0;
+
 	return Error;
 }
 
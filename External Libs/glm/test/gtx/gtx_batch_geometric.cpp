@@ -0,0 +1,153 @@
+#include <glm/gtx/batch_geometric.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+namespace
+{
+	glm::vec4 make_vector(std::size_t i)
+	{
+		float const f = static_cast<float>(i);
+		return glm::vec4(f * 0.25f - 3.0f, 1.0f / (f + 1.0f), f * -0.5f, 2.0f);
+	}
+}//namespace
+
+namespace dot
+{
+	int test()
+	{
+		int Error = 0;
+
+		// every tail length of the 4 wide kernel
+		for(std::size_t Count = 0; Count < 13; ++Count)
+		{
+			std::vector<glm::vec4> A(Count + 1), B(Count + 1);
+			std::vector<float> Out(Count + 1, 0.0f);
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				A[i] = make_vector(i);
+				B[i] = make_vector(i + 7);
+			}
+
+			glm::batchDot(&A[0], &B[0], &Out[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += glm::epsilonEqual(Out[i], glm::dot(A[i], B[i]), 0.0001f) ? 0 : 1;
+			Error += Out[Count] == 0.0f ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int test_double()
+	{
+		int Error = 0;
+
+		std::vector<glm::dvec4> A(3), B(3);
+		std::vector<double> Out(3);
+		for(std::size_t i = 0; i < A.size(); ++i)
+		{
+			A[i] = glm::dvec4(make_vector(i));
+			B[i] = glm::dvec4(make_vector(i + 1));
+		}
+
+		glm::batchDot(&A[0], &B[0], &Out[0], A.size());
+		for(std::size_t i = 0; i < A.size(); ++i)
+			Error += Out[i] == glm::dot(A[i], B[i]) ? 0 : 1;
+
+		return Error;
+	}
+
+	int perf(std::size_t Count)
+	{
+		std::vector<glm::vec4> A(Count), B(Count);
+		std::vector<float> Out(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			A[i] = make_vector(i);
+			B[i] = make_vector(i + 1);
+		}
+
+		std::clock_t const StartLoop = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = glm::dot(A[i], B[i]);
+		std::clock_t const StartBatch = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+			glm::batchDot(&A[0], &B[0], &Out[0], Count);
+		std::clock_t const End = std::clock();
+
+		std::printf("dot loop: %d clocks\n", static_cast<int>(StartBatch - StartLoop));
+		std::printf("batchDot: %d clocks\n", static_cast<int>(End - StartBatch));
+
+		return 0;
+	}
+}//namespace dot
+
+namespace normalize
+{
+	int test()
+	{
+		int Error = 0;
+
+		for(std::size_t Count = 0; Count < 13; ++Count)
+		{
+			std::vector<glm::vec4> In(Count + 1), Out(Count + 1, glm::vec4(0.0f));
+			for(std::size_t i = 0; i < Count; ++i)
+				In[i] = make_vector(i);
+
+			glm::batchNormalize(&In[0], &Out[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				Error += glm::all(glm::epsilonEqual(Out[i], glm::normalize(In[i]), 0.0001f)) ? 0 : 1;
+				Error += glm::epsilonEqual(glm::length(Out[i]), 1.0f, 0.0001f) ? 0 : 1;
+			}
+			Error += Out[Count] == glm::vec4(0.0f) ? 0 : 1;
+
+			// in place
+			glm::batchNormalize(&In[0], &In[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += In[i] == Out[i] ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int perf(std::size_t Count)
+	{
+		std::vector<glm::vec4> In(Count), Out(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = make_vector(i);
+
+		std::clock_t const StartLoop = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = glm::normalize(In[i]);
+		std::clock_t const StartBatch = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+			glm::batchNormalize(&In[0], &Out[0], Count);
+		std::clock_t const End = std::clock();
+
+		std::printf("normalize loop: %d clocks\n", static_cast<int>(StartBatch - StartLoop));
+		std::printf("batchNormalize: %d clocks\n", static_cast<int>(End - StartBatch));
+
+		return 0;
+	}
+}//namespace normalize
+
+int main()
+{
+	int Error = 0;
+
+	Error += dot::test();
+	Error += dot::test_double();
+	Error += normalize::test();
+
+#	ifdef NDEBUG
+		std::size_t const Samples = 1 << 20;
+		Error += dot::perf(Samples);
+		Error += normalize::perf(Samples);
+#	endif//NDEBUG
+
+	return Error;
+}
@@ -0,0 +1,179 @@
+#include <glm/gtx/batch_matrix.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+namespace
+{
+	// translation * rotation * scale, well conditioned
+	glm::mat4 make_affine(std::size_t i)
+	{
+		float const f = static_cast<float>(i) * 0.37f + 0.1f;
+		glm::mat4 const T = glm::translate(glm::mat4(1.0f), glm::vec3(f, -2.0f * f, 3.0f - f));
+		glm::mat4 const R = glm::rotate(glm::mat4(1.0f), f, glm::normalize(glm::vec3(1.0f, f, 2.0f)));
+		return glm::scale(T * R, glm::vec3(1.0f + f * 0.1f, 2.0f, 0.5f));
+	}
+
+	// a projection doesn't have the affine last row
+	glm::mat4 make_general(std::size_t i)
+	{
+		float const f = static_cast<float>(i) * 0.01f;
+		return glm::perspective(0.7f + f, 1.5f, 0.1f, 100.0f) * make_affine(i);
+	}
+
+	int equal(glm::mat4 const & a, glm::mat4 const & b, float Epsilon)
+	{
+		int Error = 0;
+		for(glm::length_t c = 0; c < 4; ++c)
+			Error += glm::all(glm::epsilonEqual(a[c], b[c], Epsilon)) ? 0 : 1;
+		return Error;
+	}
+}//namespace
+
+namespace mul
+{
+	int test()
+	{
+		int Error = 0;
+
+		for(std::size_t Count = 0; Count < 19; ++Count)
+		{
+			std::vector<glm::mat4> A(Count + 1), B(Count + 1), Out(Count + 1, glm::mat4(0.0f));
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				A[i] = make_general(i);
+				B[i] = make_affine(i + 5);
+			}
+
+			glm::batchMul(&A[0], &B[0], &Out[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += equal(Out[i], A[i] * B[i], 0.001f);
+			Error += Out[Count] == glm::mat4(0.0f) ? 0 : 1;
+
+			// in place, as a world matrix update would
+			glm::batchMul(&A[0], &B[0], &A[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += A[i] == Out[i] ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int perf(std::size_t Count)
+	{
+		std::vector<glm::mat4> Parent(Count), Local(Count), World(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Parent[i] = make_affine(i);
+			Local[i] = make_affine(i + 1);
+		}
+
+		std::clock_t const StartLoop = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+		for(std::size_t i = 0; i < Count; ++i)
+			World[i] = Parent[i] * Local[i];
+		std::clock_t const StartBatch = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+			glm::batchMul(&Parent[0], &Local[0], &World[0], Count);
+		std::clock_t const End = std::clock();
+
+		std::printf("mat4 * mat4 loop: %d clocks\n", static_cast<int>(StartBatch - StartLoop));
+		std::printf("batchMul: %d clocks\n", static_cast<int>(End - StartBatch));
+
+		return 0;
+	}
+}//namespace mul
+
+namespace inverse
+{
+	int test()
+	{
+		int Error = 0;
+
+		for(std::size_t Count = 0; Count < 19; ++Count)
+		{
+			std::vector<glm::mat4> In(Count + 1), Out(Count + 1), Affine(Count + 1);
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				In[i] = make_general(i);
+				Affine[i] = make_affine(i);
+			}
+
+			glm::batchInverse(&In[0], &Out[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				Error += equal(Out[i], glm::inverse(In[i]), 0.001f);
+				Error += equal(Out[i] * In[i], glm::mat4(1.0f), 0.001f);
+			}
+
+			glm::batchAffineInverse(&Affine[0], &Out[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += equal(Out[i], glm::affineInverse(Affine[i]), 0.001f);
+
+			glm::batchAffineInverse(&Affine[0], &Affine[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += Affine[i] == Out[i] ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int test_double()
+	{
+		int Error = 0;
+
+		std::vector<glm::dmat4> In(3), Out(3);
+		for(std::size_t i = 0; i < In.size(); ++i)
+			In[i] = glm::dmat4(make_affine(i));
+
+		glm::batchInverse(&In[0], &Out[0], In.size());
+		for(std::size_t i = 0; i < In.size(); ++i)
+			Error += equal(glm::mat4(Out[i] * In[i]), glm::mat4(1.0f), 0.0001f);
+
+		return Error;
+	}
+
+	int perf(std::size_t Count)
+	{
+		std::vector<glm::mat4> In(Count), Out(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = make_affine(i);
+
+		std::clock_t const StartLoop = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = glm::inverse(In[i]);
+		std::clock_t const StartBatch = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+			glm::batchInverse(&In[0], &Out[0], Count);
+		std::clock_t const StartAffine = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+			glm::batchAffineInverse(&In[0], &Out[0], Count);
+		std::clock_t const End = std::clock();
+
+		std::printf("inverse loop: %d clocks\n", static_cast<int>(StartBatch - StartLoop));
+		std::printf("batchInverse: %d clocks\n", static_cast<int>(StartAffine - StartBatch));
+		std::printf("batchAffineInverse: %d clocks\n", static_cast<int>(End - StartAffine));
+
+		return 0;
+	}
+}//namespace inverse
+
+int main()
+{
+	int Error = 0;
+
+	Error += mul::test();
+	Error += inverse::test();
+	Error += inverse::test_double();
+
+#	ifdef NDEBUG
+		std::size_t const Samples = 1 << 16;
+		Error += mul::perf(Samples);
+		Error += inverse::perf(Samples);
+#	endif//NDEBUG
+
+	return Error;
+}
@@ -0,0 +1,228 @@
+#include <glm/gtx/batch_transform.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+namespace
+{
+	glm::mat4 make_matrix()
+	{
+		glm::mat4 const Projection = glm::perspective(0.8f, 4.0f / 3.0f, 0.1f, 100.0f);
+		glm::mat4 const View = glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, -2.0f, -5.0f));
+		return Projection * glm::rotate(View, 0.5f, glm::vec3(0.0f, 1.0f, 0.0f));
+	}
+
+	glm::vec4 make_vector(std::size_t i)
+	{
+		float const f = static_cast<float>(i);
+		return glm::vec4(f * 0.25f - 3.0f, 1.0f / (f + 1.0f), f * -0.5f, 1.0f);
+	}
+}//namespace
+
+namespace aos
+{
+	int test()
+	{
+		int Error = 0;
+		glm::mat4 const M = make_matrix();
+
+		// every tail length of the 4, 8 and 16 wide kernels
+		for(std::size_t Count = 0; Count < 37; ++Count)
+		{
+			std::vector<glm::vec4> In(Count), Out(Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				In[i] = make_vector(i);
+
+			glm::batchTransform(M, In.empty() ? NULL : &In[0], Out.empty() ? NULL : &Out[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += glm::all(glm::epsilonEqual(Out[i], M * In[i], 0.0001f)) ? 0 : 1;
+
+			// in place
+			if(!In.empty())
+				glm::batchTransform(M, &In[0], &In[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += glm::all(glm::epsilonEqual(In[i], Out[i], 0.0001f)) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int test_double()
+	{
+		int Error = 0;
+		glm::dmat4 const M(make_matrix());
+
+		std::vector<glm::dvec4> In(5), Out(5);
+		for(std::size_t i = 0; i < In.size(); ++i)
+			In[i] = glm::dvec4(make_vector(i));
+
+		glm::batchTransform(M, &In[0], &Out[0], In.size());
+		for(std::size_t i = 0; i < In.size(); ++i)
+			Error += glm::all(glm::epsilonEqual(Out[i], M * In[i], 0.0001)) ? 0 : 1;
+
+		return Error;
+	}
+
+	int perf(std::size_t Count)
+	{
+		glm::mat4 const M = make_matrix();
+		std::vector<glm::vec4> In(Count), Out(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = make_vector(i);
+
+		std::clock_t const StartLoop = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = M * In[i];
+		std::clock_t const StartBatch = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+			glm::batchTransform(M, &In[0], &Out[0], Count);
+		std::clock_t const End = std::clock();
+
+		std::printf("mat4 * vec4 loop: %d clocks\n", static_cast<int>(StartBatch - StartLoop));
+		std::printf("batchTransform: %d clocks\n", static_cast<int>(End - StartBatch));
+
+		return 0;
+	}
+}//namespace aos
+
+namespace each
+{
+	int test()
+	{
+		int Error = 0;
+
+		// every tail length of the 4 matrices per register kernel
+		for(std::size_t Count = 0; Count < 13; ++Count)
+		{
+			std::vector<glm::mat4> M(Count + 1);
+			std::vector<glm::vec4> In(Count + 1), Out(Count + 1, glm::vec4(0.0f));
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				M[i] = glm::rotate(make_matrix(), static_cast<float>(i) * 0.3f, glm::vec3(1.0f, 0.0f, 0.0f));
+				In[i] = make_vector(i);
+			}
+
+			glm::batchTransform(&M[0], &In[0], &Out[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += glm::all(glm::epsilonEqual(Out[i], M[i] * In[i], 0.0001f)) ? 0 : 1;
+			Error += Out[Count] == glm::vec4(0.0f) ? 0 : 1;
+
+			// in place
+			glm::batchTransform(&M[0], &In[0], &In[0], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += In[i] == Out[i] ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int perf(std::size_t Count)
+	{
+		std::vector<glm::mat4> M(Count);
+		std::vector<glm::vec4> In(Count), Out(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			M[i] = glm::rotate(make_matrix(), static_cast<float>(i), glm::vec3(0.0f, 0.0f, 1.0f));
+			In[i] = make_vector(i);
+		}
+
+		std::clock_t const StartLoop = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = M[i] * In[i];
+		std::clock_t const StartBatch = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+			glm::batchTransform(&M[0], &In[0], &Out[0], Count);
+		std::clock_t const End = std::clock();
+
+		std::printf("mat4[i] * vec4 loop: %d clocks\n", static_cast<int>(StartBatch - StartLoop));
+		std::printf("batchTransform per vector matrix: %d clocks\n", static_cast<int>(End - StartBatch));
+
+		return 0;
+	}
+}//namespace each
+
+namespace soa
+{
+	int test()
+	{
+		int Error = 0;
+		glm::mat4 const M = make_matrix();
+
+		for(std::size_t Count = 0; Count < 37; ++Count)
+		{
+			std::vector<float> In[4], Out[4];
+			for(int c = 0; c < 4; ++c)
+			{
+				In[c].resize(Count + 1);
+				Out[c].resize(Count + 1);
+			}
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				glm::vec4 const v = make_vector(i);
+				for(int c = 0; c < 4; ++c)
+					In[c][i] = v[c];
+			}
+
+			float const * const InPtr[4] = {&In[0][0], &In[1][0], &In[2][0], &In[3][0]};
+			float * const OutPtr[4] = {&Out[0][0], &Out[1][0], &Out[2][0], &Out[3][0]};
+			glm::batchTransformSoA(M, InPtr, OutPtr, Count);
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				glm::vec4 const Expected = M * make_vector(i);
+				glm::vec4 const Result(Out[0][i], Out[1][i], Out[2][i], Out[3][i]);
+				Error += glm::all(glm::epsilonEqual(Result, Expected, 0.0001f)) ? 0 : 1;
+			}
+			// the element after the last must not be written
+			for(int c = 0; c < 4; ++c)
+				Error += Out[c][Count] == 0.0f ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int perf(std::size_t Count)
+	{
+		glm::mat4 const M = make_matrix();
+		std::vector<float> In[4], Out[4];
+		for(int c = 0; c < 4; ++c)
+		{
+			In[c].resize(Count, 1.0f);
+			Out[c].resize(Count);
+		}
+		float const * const InPtr[4] = {&In[0][0], &In[1][0], &In[2][0], &In[3][0]};
+		float * const OutPtr[4] = {&Out[0][0], &Out[1][0], &Out[2][0], &Out[3][0]};
+
+		std::clock_t const Start = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+			glm::batchTransformSoA(M, InPtr, OutPtr, Count);
+		std::clock_t const End = std::clock();
+
+		std::printf("batchTransformSoA: %d clocks\n", static_cast<int>(End - Start));
+
+		return 0;
+	}
+}//namespace soa
+
+int main()
+{
+	int Error = 0;
+
+	Error += aos::test();
+	Error += aos::test_double();
+	Error += each::test();
+	Error += soa::test();
+
+#	ifdef NDEBUG
+		std::size_t const Samples = 1 << 20;
+		Error += aos::perf(Samples);
+		Error += each::perf(Samples >> 2);
+		Error += soa::perf(Samples);
+#	endif//NDEBUG
+
+	return Error;
+}
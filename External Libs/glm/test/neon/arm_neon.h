@@ -0,0 +1,313 @@
+/// @ref test
+/// @file test/neon/arm_neon.h
+///
+/// The subset of the AArch64 NEON intrinsics GLM uses, written with GCC / Clang
+/// vector extensions so the NEON code paths build and run on x86 with GLM_FORCE_NEON.
+/// The types are distinct like the real ones: mixing int32x4_t and uint32x4_t
+/// without a vreinterpretq is an error here as well.
+///
+/// Results follow the Arm Architecture Reference Manual: min/max propagate NaN,
+/// vaddvq and vpaddq add pairwise, vfmaq is fused and the reciprocal (square root)
+/// estimates keep 8 bits of mantissa. Lane indices are not checked for being
+/// immediates, the real compilers do that.
+
+#pragma once
+
+#if !defined(__GNUC__) && !defined(__clang__)
+#	error "The NEON emulation needs GCC or Clang vector extensions"
+#endif
+
+#include <math.h>
+#include <string.h>
+#include <stdint.h>
+
+typedef float float32x4_t __attribute__((vector_size(16)));
+typedef float float32x2_t __attribute__((vector_size(8)));
+typedef int32_t int32x4_t __attribute__((vector_size(16)));
+typedef uint32_t uint32x4_t __attribute__((vector_size(16)));
+
+namespace glm_neon_emulation
+{
+	inline float32x4_t from_lanes(float a, float b, float c, float d)
+	{
+		float32x4_t r;
+		r[0] = a; r[1] = b; r[2] = c; r[3] = d;
+		return r;
+	}
+
+	inline uint32x4_t from_mask(int32x4_t m)
+	{
+		return (uint32x4_t)m;
+	}
+
+	// keeps the 8 leading mantissa bits like FRECPE / FRSQRTE
+	inline float estimate(float x)
+	{
+		if(x != x || x == 0.0f || fabsf(x) == HUGE_VALF)
+			return x;
+		uint32_t bits;
+		memcpy(&bits, &x, sizeof(bits));
+		bits &= 0xFFFF8000u;
+		memcpy(&x, &bits, sizeof(bits));
+		return x;
+	}
+
+	inline float min(float a, float b)
+	{
+		return a != a ? a : (b != b ? b : (a < b ? a : b));
+	}
+
+	inline float max(float a, float b)
+	{
+		return a != a ? a : (b != b ? b : (a > b ? a : b));
+	}
+
+	// SSHL / USHL, the count is the signed low byte of each lane
+	inline int32_t shl(int32_t a, int32_t b)
+	{
+		int8_t const n = static_cast<int8_t>(b);
+		if(n >= 32) return 0;
+		if(n >= 0) return static_cast<int32_t>(static_cast<uint32_t>(a) << n);
+		if(n <= -32) return a < 0 ? -1 : 0;
+		return a >> -n;
+	}
+
+	inline uint32_t shl(uint32_t a, int32_t b)
+	{
+		int8_t const n = static_cast<int8_t>(b);
+		if(n >= 32 || n <= -32) return 0;
+		return n >= 0 ? a << n : a >> -n;
+	}
+}//namespace glm_neon_emulation
+
+// -- Arithmetic --
+
+inline float32x4_t vaddq_f32(float32x4_t a, float32x4_t b) { return a + b; }
+inline float32x4_t vsubq_f32(float32x4_t a, float32x4_t b) { return a - b; }
+inline float32x4_t vmulq_f32(float32x4_t a, float32x4_t b) { return a * b; }
+inline float32x4_t vdivq_f32(float32x4_t a, float32x4_t b) { return a / b; }
+inline float32x4_t vnegq_f32(float32x4_t a) { return -a; }
+inline int32x4_t vnegq_s32(int32x4_t a) { return -a; }
+
+inline float32x4_t vmulq_laneq_f32(float32x4_t a, float32x4_t v, int lane)
+{
+	return a * v[lane];
+}
+
+inline float32x4_t vfmaq_f32(float32x4_t c, float32x4_t a, float32x4_t b)
+{
+	float32x4_t r;
+	for(int i = 0; i < 4; ++i)
+		r[i] = fmaf(a[i], b[i], c[i]);
+	return r;
+}
+
+inline float32x4_t vabsq_f32(float32x4_t a)
+{
+	return (float32x4_t)((uint32x4_t)a & 0x7FFFFFFFu);
+}
+
+inline int32x4_t vabsq_s32(int32x4_t a)
+{
+	return (int32x4_t)(((uint32x4_t)a ^ (uint32x4_t)(a >> 31)) - (uint32x4_t)(a >> 31));
+}
+
+inline float32x4_t vsqrtq_f32(float32x4_t a)
+{
+	float32x4_t r;
+	for(int i = 0; i < 4; ++i)
+		r[i] = sqrtf(a[i]);
+	return r;
+}
+
+inline float32x4_t vrecpeq_f32(float32x4_t a)
+{
+	float32x4_t r;
+	for(int i = 0; i < 4; ++i)
+		r[i] = glm_neon_emulation::estimate(1.0f / a[i]);
+	return r;
+}
+
+inline float32x4_t vrecpsq_f32(float32x4_t a, float32x4_t b)
+{
+	return 2.0f - a * b;
+}
+
+inline float32x4_t vrsqrteq_f32(float32x4_t a)
+{
+	float32x4_t r;
+	for(int i = 0; i < 4; ++i)
+		r[i] = glm_neon_emulation::estimate(1.0f / sqrtf(a[i]));
+	return r;
+}
+
+inline float32x4_t vrsqrtsq_f32(float32x4_t a, float32x4_t b)
+{
+	return (3.0f - a * b) * 0.5f;
+}
+
+inline float32x4_t vminq_f32(float32x4_t a, float32x4_t b)
+{
+	float32x4_t r;
+	for(int i = 0; i < 4; ++i)
+		r[i] = glm_neon_emulation::min(a[i], b[i]);
+	return r;
+}
+
+inline float32x4_t vmaxq_f32(float32x4_t a, float32x4_t b)
+{
+	float32x4_t r;
+	for(int i = 0; i < 4; ++i)
+		r[i] = glm_neon_emulation::max(a[i], b[i]);
+	return r;
+}
+
+#define GLM_NEON_EMULATE_MINMAX(name, type, op) \
+	inline type name(type a, type b) \
+	{ \
+		type r; \
+		for(int i = 0; i < 4; ++i) \
+			r[i] = a[i] op b[i] ? a[i] : b[i]; \
+		return r; \
+	}
+
+GLM_NEON_EMULATE_MINMAX(vminq_s32, int32x4_t, <)
+GLM_NEON_EMULATE_MINMAX(vmaxq_s32, int32x4_t, >)
+GLM_NEON_EMULATE_MINMAX(vminq_u32, uint32x4_t, <)
+GLM_NEON_EMULATE_MINMAX(vmaxq_u32, uint32x4_t, >)
+
+#undef GLM_NEON_EMULATE_MINMAX
+
+// -- Horizontal --
+
+inline float32x4_t vpaddq_f32(float32x4_t a, float32x4_t b)
+{
+	return glm_neon_emulation::from_lanes(a[0] + a[1], a[2] + a[3], b[0] + b[1], b[2] + b[3]);
+}
+
+inline float vaddvq_f32(float32x4_t a)
+{
+	return (a[0] + a[1]) + (a[2] + a[3]);
+}
+
+inline uint32_t vminvq_u32(uint32x4_t a)
+{
+	uint32_t const lo = a[0] < a[1] ? a[0] : a[1];
+	uint32_t const hi = a[2] < a[3] ? a[2] : a[3];
+	return lo < hi ? lo : hi;
+}
+
+// -- Rounding --
+
+#define GLM_NEON_EMULATE_ROUND(name, func) \
+	inline float32x4_t name(float32x4_t a) \
+	{ \
+		float32x4_t r; \
+		for(int i = 0; i < 4; ++i) \
+			r[i] = func(a[i]); \
+		return r; \
+	}
+
+GLM_NEON_EMULATE_ROUND(vrndaq_f32, roundf)
+GLM_NEON_EMULATE_ROUND(vrndmq_f32, floorf)
+GLM_NEON_EMULATE_ROUND(vrndq_f32, truncf)
+GLM_NEON_EMULATE_ROUND(vrndnq_f32, nearbyintf)
+GLM_NEON_EMULATE_ROUND(vrndpq_f32, ceilf)
+
+#undef GLM_NEON_EMULATE_ROUND
+
+inline float32x4_t vcvtq_f32_s32(int32x4_t a)
+{
+	return glm_neon_emulation::from_lanes(
+		static_cast<float>(a[0]), static_cast<float>(a[1]), static_cast<float>(a[2]), static_cast<float>(a[3]));
+}
+
+// -- Compare and select --
+
+inline uint32x4_t vceqq_f32(float32x4_t a, float32x4_t b) { return glm_neon_emulation::from_mask(a == b); }
+inline uint32x4_t vcltq_f32(float32x4_t a, float32x4_t b) { return glm_neon_emulation::from_mask(a < b); }
+inline uint32x4_t vcgtq_f32(float32x4_t a, float32x4_t b) { return glm_neon_emulation::from_mask(a > b); }
+inline uint32x4_t vcgeq_f32(float32x4_t a, float32x4_t b) { return glm_neon_emulation::from_mask(a >= b); }
+inline uint32x4_t vceqq_s32(int32x4_t a, int32x4_t b) { return glm_neon_emulation::from_mask(a == b); }
+inline uint32x4_t vceqq_u32(uint32x4_t a, uint32x4_t b) { return glm_neon_emulation::from_mask(a == b); }
+
+inline float32x4_t vbslq_f32(uint32x4_t m, float32x4_t a, float32x4_t b)
+{
+	return (float32x4_t)((m & (uint32x4_t)a) | (~m & (uint32x4_t)b));
+}
+
+// -- Bitwise --
+
+inline int32x4_t vandq_s32(int32x4_t a, int32x4_t b) { return a & b; }
+inline uint32x4_t vandq_u32(uint32x4_t a, uint32x4_t b) { return a & b; }
+inline int32x4_t vorrq_s32(int32x4_t a, int32x4_t b) { return a | b; }
+inline uint32x4_t vorrq_u32(uint32x4_t a, uint32x4_t b) { return a | b; }
+inline int32x4_t veorq_s32(int32x4_t a, int32x4_t b) { return a ^ b; }
+inline uint32x4_t veorq_u32(uint32x4_t a, uint32x4_t b) { return a ^ b; }
+inline int32x4_t vmvnq_s32(int32x4_t a) { return ~a; }
+inline uint32x4_t vmvnq_u32(uint32x4_t a) { return ~a; }
+
+inline int32x4_t vshlq_s32(int32x4_t a, int32x4_t b)
+{
+	int32x4_t r;
+	for(int i = 0; i < 4; ++i)
+		r[i] = glm_neon_emulation::shl(static_cast<int32_t>(a[i]), static_cast<int32_t>(b[i]));
+	return r;
+}
+
+inline uint32x4_t vshlq_u32(uint32x4_t a, int32x4_t b)
+{
+	uint32x4_t r;
+	for(int i = 0; i < 4; ++i)
+		r[i] = glm_neon_emulation::shl(static_cast<uint32_t>(a[i]), static_cast<int32_t>(b[i]));
+	return r;
+}
+
+// -- Reinterpret --
+
+inline float32x4_t vreinterpretq_f32_u32(uint32x4_t a) { return (float32x4_t)a; }
+inline uint32x4_t vreinterpretq_u32_f32(float32x4_t a) { return (uint32x4_t)a; }
+inline int32x4_t vreinterpretq_s32_u32(uint32x4_t a) { return (int32x4_t)a; }
+inline uint32x4_t vreinterpretq_u32_s32(int32x4_t a) { return (uint32x4_t)a; }
+
+// -- Load, store, lanes --
+
+inline float32x4_t vld1q_f32(float const* p) { float32x4_t r; memcpy(&r, p, sizeof(r)); return r; }
+inline int32x4_t vld1q_s32(int32_t const* p) { int32x4_t r; memcpy(&r, p, sizeof(r)); return r; }
+inline uint32x4_t vld1q_u32(uint32_t const* p) { uint32x4_t r; memcpy(&r, p, sizeof(r)); return r; }
+inline void vst1q_f32(float* p, float32x4_t a) { memcpy(p, &a, sizeof(a)); }
+
+inline float32x4_t vdupq_n_f32(float s) { float32x4_t r = {s, s, s, s}; return r; }
+inline int32x4_t vdupq_n_s32(int32_t s) { int32x4_t r = {s, s, s, s}; return r; }
+inline uint32x4_t vdupq_n_u32(uint32_t s) { uint32x4_t r = {s, s, s, s}; return r; }
+
+inline float32x4_t vdupq_laneq_f32(float32x4_t a, int lane) { return vdupq_n_f32(a[lane]); }
+inline int32x4_t vdupq_laneq_s32(int32x4_t a, int lane) { return vdupq_n_s32(a[lane]); }
+inline uint32x4_t vdupq_laneq_u32(uint32x4_t a, int lane) { return vdupq_n_u32(a[lane]); }
+inline float32x2_t vdup_laneq_f32(float32x4_t a, int lane) { float32x2_t r = {a[lane], a[lane]}; return r; }
+
+inline float vgetq_lane_f32(float32x4_t a, int lane) { return a[lane]; }
+inline float32x4_t vsetq_lane_f32(float s, float32x4_t a, int lane) { a[lane] = s; return a; }
+inline int32x4_t vsetq_lane_s32(int32_t s, int32x4_t a, int lane) { a[lane] = s; return a; }
+
+inline float32x4_t vcopyq_laneq_f32(float32x4_t a, int lane1, float32x4_t b, int lane2) { a[lane1] = b[lane2]; return a; }
+inline int32x4_t vcopyq_laneq_s32(int32x4_t a, int lane1, int32x4_t b, int lane2) { a[lane1] = b[lane2]; return a; }
+inline uint32x4_t vcopyq_laneq_u32(uint32x4_t a, int lane1, uint32x4_t b, int lane2) { a[lane1] = b[lane2]; return a; }
+
+// -- Permutes --
+
+inline float32x2_t vget_low_f32(float32x4_t a) { float32x2_t r = {a[0], a[1]}; return r; }
+inline float32x2_t vget_high_f32(float32x4_t a) { float32x2_t r = {a[2], a[3]}; return r; }
+inline float32x4_t vcombine_f32(float32x2_t lo, float32x2_t hi) { return glm_neon_emulation::from_lanes(lo[0], lo[1], hi[0], hi[1]); }
+
+inline float32x4_t vextq_f32(float32x4_t a, float32x4_t b, int n)
+{
+	float32x4_t r;
+	for(int i = 0; i < 4; ++i)
+		r[i] = i + n < 4 ? a[i + n] : b[i + n - 4];
+	return r;
+}
+
+inline float32x4_t vtrn1q_f32(float32x4_t a, float32x4_t b) { return glm_neon_emulation::from_lanes(a[0], b[0], a[2], b[2]); }
+inline float32x4_t vtrn2q_f32(float32x4_t a, float32x4_t b) { return glm_neon_emulation::from_lanes(a[1], b[1], a[3], b[3]); }
+inline float32x4_t vzip1q_f32(float32x4_t a, float32x4_t b) { return glm_neon_emulation::from_lanes(a[0], b[0], a[1], b[1]); }
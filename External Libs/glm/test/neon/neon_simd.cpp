@@ -0,0 +1,485 @@
+#define GLM_FORCE_SWIZZLE
+#include <glm/glm.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+// The aligned types take the NEON code paths, the packed types the scalar
+// ones: both are built in the same binary and compared lane by lane.
+
+#if (GLM_ARCH & GLM_ARCH_NEON_BIT) && GLM_HAS_ALIGNED_TYPE
+#include <glm/gtc/type_aligned.hpp>
+
+namespace
+{
+	typedef glm::tvec4<float, glm::aligned_highp> avec4;
+	typedef glm::tvec4<float, glm::packed_highp> pvec4;
+	typedef glm::tvec4<glm::int32, glm::aligned_highp> aivec4;
+	typedef glm::tvec4<glm::int32, glm::packed_highp> pivec4;
+	typedef glm::tvec4<glm::uint32, glm::aligned_highp> auvec4;
+	typedef glm::tvec4<glm::uint32, glm::packed_highp> puvec4;
+	typedef glm::tvec4<bool, glm::aligned_highp> abvec4;
+	typedef glm::tmat4x4<float, glm::aligned_highp> amat4;
+	typedef glm::tmat4x4<float, glm::packed_highp> pmat4;
+
+	// half way cases for the rounding, negative zero and values a few ulps
+	// either side of the integers
+	float const Specials[] = {
+		0.0f, -0.0f, 0.5f, -0.5f, 1.5f, -1.5f, 2.5f, -2.5f, 0.49999997f, -0.49999997f,
+		1.0f, -1.0f, 3.0000002f, -3.0000002f, 1e-7f, -1e-7f, 12345.678f, -8388607.5f};
+	std::size_t const SpecialCount = sizeof(Specials) / sizeof(Specials[0]);
+
+	float make_float(std::size_t i)
+	{
+		if(i < SpecialCount)
+			return Specials[i];
+		float const f = static_cast<float>((i * 2654435761u) % 20011u);
+		return (f - 10005.0f) / 97.0f;
+	}
+
+	pvec4 make_vector(std::size_t i)
+	{
+		return pvec4(make_float(i), make_float(i + 5), make_float(i + 11), make_float(i + 17));
+	}
+
+	// diagonally dominant so that the inverse and the determinant stay well
+	// conditioned: entries in [-1, 1] off the diagonal
+	pmat4 make_matrix(std::size_t i)
+	{
+		pmat4 m(
+			make_vector(i + SpecialCount),
+			make_vector(i + SpecialCount + 1),
+			make_vector(i + SpecialCount + 2),
+			make_vector(i + SpecialCount + 3));
+		m /= 104.0f;
+		for(glm::length_t k = 0; k < 4; ++k)
+			m[k][k] += 4.0f;
+		return m;
+	}
+
+	// bit exact, which only holds with the multiply-adds left unfused on
+	// both sides: the test is built with -ffp-contract=off
+	bool same(float a, float b)
+	{
+		return a == b || (a != a && b != b);
+	}
+
+	template <typename T, glm::precision P, glm::precision Q>
+	int check(glm::tvec4<T, P> const & a, glm::tvec4<T, Q> const & b)
+	{
+		for(glm::length_t c = 0; c < 4; ++c)
+			if(!same(static_cast<float>(a[c]), static_cast<float>(b[c])))
+				return 1;
+		return 0;
+	}
+
+	int check(float a, float b)
+	{
+		return same(a, b) ? 0 : 1;
+	}
+
+	std::size_t const Count = 256;
+}//namespace
+
+namespace vec4
+{
+	int test_arithmetic()
+	{
+		int Error = 0;
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			pvec4 const A = make_vector(i);
+			pvec4 const B = make_vector(i + 3);
+			avec4 const a(A), b(B);
+
+			Error += check(a + b, A + B);
+			Error += check(a - b, A - B);
+			Error += check(a * b, A * B);
+			Error += check(a / b, A / B);
+			Error += check(a * 3.0f, A * 3.0f);
+			Error += check(-a, -A);
+		}
+
+		// one Newton-Raphson step on the estimate
+		glm::tvec4<float, glm::aligned_lowp> const Num(1.0f, -2.0f, 3.0f, 1000.0f);
+		glm::tvec4<float, glm::aligned_lowp> const Den(3.0f, 7.0f, -0.25f, 3.0f);
+		glm::tvec4<float, glm::aligned_lowp> const Quot = Num / Den;
+		for(glm::length_t c = 0; c < 4; ++c)
+			Error += glm::epsilonEqual(Quot[c], Num[c] / Den[c], glm::abs(Num[c] / Den[c]) * 1e-4f) ? 0 : 1;
+
+		return Error;
+	}
+
+	int test_ctor()
+	{
+		int Error = 0;
+
+		Error += check(avec4(1.0f, 2.0f, 3.0f, 4.0f), pvec4(1.0f, 2.0f, 3.0f, 4.0f));
+		Error += check(avec4(-2.5f), pvec4(-2.5f));
+		Error += check(avec4(1, -2, 3, 16777217), pvec4(1, -2, 3, 16777217));
+		Error += check(aivec4(1, -2, 3, -4), pivec4(1, -2, 3, -4));
+		Error += check(aivec4(-7), pivec4(-7));
+		Error += check(auvec4(7u), puvec4(7u));
+
+		return Error;
+	}
+
+	int test_compare()
+	{
+		int Error = 0;
+
+		avec4 const A(1.0f, 2.0f, 3.0f, 4.0f);
+		Error += A == avec4(1.0f, 2.0f, 3.0f, 4.0f) ? 0 : 1;
+		Error += A == avec4(1.0f, 2.0f, 3.0f, 5.0f) ? 1 : 0;
+		Error += A != avec4(1.0f, 2.0f, 3.0f, 5.0f) ? 0 : 1;
+		Error += A != avec4(1.0f, 2.0f, 3.0f, 4.0f) ? 1 : 0;
+		Error += avec4(-0.0f) == avec4(0.0f) ? 0 : 1;
+
+		aivec4 const I(1, 2, 3, 4);
+		Error += I == aivec4(1, 2, 3, 4) ? 0 : 1;
+		Error += I == aivec4(0, 2, 3, 4) ? 1 : 0;
+		Error += I != aivec4(0, 2, 3, 4) ? 0 : 1;
+
+		auvec4 const U(1u, 2u, 3u, 4u);
+		Error += U == auvec4(1u, 2u, 3u, 4u) ? 0 : 1;
+		Error += U != auvec4(1u, 2u, 3u, 0u) ? 0 : 1;
+
+		return Error;
+	}
+
+	int test_integer()
+	{
+		int Error = 0;
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			pivec4 const A(make_vector(i) * 1000.0f);
+			pivec4 const B(make_vector(i + 1) * 1000.0f);
+			pivec4 const S(glm::abs(pivec4(make_vector(i + 2))) % 32);
+			aivec4 const a(A), b(B), s(S);
+
+			Error += check(a & b, A & B);
+			Error += check(a | b, A | B);
+			Error += check(a ^ b, A ^ B);
+			Error += check(~a, ~A);
+			Error += check(a << s, A << S);
+			Error += check(a >> s, A >> S);
+			Error += check(glm::abs(a), glm::abs(A));
+			Error += check(glm::min(a, b), glm::min(A, B));
+			Error += check(glm::max(a, b), glm::max(A, B));
+			Error += check(glm::clamp(a, aivec4(-100), aivec4(100)), glm::clamp(A, pivec4(-100), pivec4(100)));
+
+			puvec4 const UA(A), UB(B), US(S);
+			auvec4 const ua(UA), ub(UB), us(US);
+			Error += check(ua & ub, UA & UB);
+			Error += check(ua | ub, UA | UB);
+			Error += check(ua ^ ub, UA ^ UB);
+			Error += check(~ua, ~UA);
+			Error += check(ua << us, UA << US);
+			Error += check(ua >> us, UA >> US);
+			Error += check(glm::min(ua, ub), glm::min(UA, UB));
+			Error += check(glm::max(ua, ub), glm::max(UA, UB));
+		}
+
+		return Error;
+	}
+
+	int test_swizzle()
+	{
+		int Error = 0;
+
+#		if !GLM_HAS_ONLY_XYZW
+			avec4 const A(1.0f, 2.0f, 3.0f, 4.0f);
+			Error += check(A.wzyx(), pvec4(4.0f, 3.0f, 2.0f, 1.0f));
+			Error += check(A.xxyw(), pvec4(1.0f, 1.0f, 2.0f, 4.0f));
+
+			aivec4 const I(1, 2, 3, 4);
+			Error += check(I.zwxy(), pivec4(3, 4, 1, 2));
+#		endif//!GLM_HAS_ONLY_XYZW
+
+		return Error;
+	}
+
+	int perf(std::size_t Samples)
+	{
+		std::vector<avec4> A(Samples), B(Samples);
+		std::vector<pvec4> PA(Samples), PB(Samples);
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			PA[i] = make_vector(i);
+			PB[i] = make_vector(i + 1);
+			A[i] = avec4(PA[i]);
+			B[i] = avec4(PB[i]);
+		}
+
+		std::clock_t const StartPacked = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+		for(std::size_t i = 0; i < Samples; ++i)
+			PA[i] = glm::fract(PA[i] * PB[i] + PB[i]);
+		std::clock_t const StartAligned = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+		for(std::size_t i = 0; i < Samples; ++i)
+			A[i] = glm::fract(A[i] * B[i] + B[i]);
+		std::clock_t const End = std::clock();
+
+		std::printf("fract(a * b + b) packed: %d clocks\n", static_cast<int>(StartAligned - StartPacked));
+		std::printf("fract(a * b + b) aligned: %d clocks\n", static_cast<int>(End - StartAligned));
+
+		return check(A[Samples / 2], PA[Samples / 2]);
+	}
+}//namespace vec4
+
+namespace common
+{
+	int test()
+	{
+		int Error = 0;
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			pvec4 const A = make_vector(i);
+			pvec4 const B = make_vector(i + 7);
+			avec4 const a(A), b(B);
+
+			Error += check(glm::abs(a), glm::abs(A));
+			Error += check(glm::floor(a), glm::floor(A));
+			Error += check(glm::ceil(a), glm::ceil(A));
+			Error += check(glm::fract(a), glm::fract(A));
+			Error += check(glm::round(a), glm::round(A));
+			Error += check(glm::mod(a, b), glm::mod(A, B));
+			Error += check(glm::min(a, b), glm::min(A, B));
+			Error += check(glm::max(a, b), glm::max(A, B));
+			Error += check(glm::clamp(a, -1.0f, 1.0f), glm::clamp(A, -1.0f, 1.0f));
+			Error += check(glm::smoothstep(avec4(-1.0f), avec4(2.0f), a), glm::smoothstep(pvec4(-1.0f), pvec4(2.0f), A));
+			Error += check(glm::sqrt(glm::abs(a)), glm::sqrt(glm::abs(A)));
+
+			glm::tvec4<bool, glm::packed_highp> const M(i & 1, i & 2, i & 4, i & 8);
+			Error += check(glm::mix(a, b, abvec4(M)), glm::mix(A, B, M));
+
+			glm::tvec4<float, glm::aligned_lowp> const Low(glm::abs(A) + 1.0f);
+			glm::tvec4<float, glm::aligned_lowp> const LowSqrt = glm::sqrt(Low);
+			for(glm::length_t c = 0; c < 4; ++c)
+				Error += glm::epsilonEqual(LowSqrt[c], glm::sqrt(Low[c]), glm::sqrt(Low[c]) * 1e-4f) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int perf(std::size_t Samples)
+	{
+		std::vector<avec4> A(Samples);
+		std::vector<pvec4> PA(Samples);
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			PA[i] = make_vector(i);
+			A[i] = avec4(PA[i]);
+		}
+
+		std::clock_t const StartPacked = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+		for(std::size_t i = 0; i < Samples; ++i)
+			PA[i] = glm::smoothstep(pvec4(-1.0f), pvec4(1.0f), glm::mod(PA[i], pvec4(3.0f)));
+		std::clock_t const StartAligned = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+		for(std::size_t i = 0; i < Samples; ++i)
+			A[i] = glm::smoothstep(avec4(-1.0f), avec4(1.0f), glm::mod(A[i], avec4(3.0f)));
+		std::clock_t const End = std::clock();
+
+		std::printf("smoothstep(mod) packed: %d clocks\n", static_cast<int>(StartAligned - StartPacked));
+		std::printf("smoothstep(mod) aligned: %d clocks\n", static_cast<int>(End - StartAligned));
+
+		return check(A[Samples / 2], PA[Samples / 2]);
+	}
+}//namespace common
+
+namespace geometric
+{
+	int test()
+	{
+		int Error = 0;
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			pvec4 const A = make_vector(i);
+			pvec4 const B = make_vector(i + 3);
+			avec4 const a(A), b(B);
+
+			Error += check(glm::dot(a, b), glm::dot(A, B));
+			Error += check(glm::length(a), glm::length(A));
+			Error += check(glm::distance(a, b), glm::distance(A, B));
+			Error += check(glm::normalize(a), glm::normalize(A));
+			Error += check(glm::reflect(a, b), glm::reflect(A, B));
+			Error += check(glm::faceforward(a, b, avec4(A.y, A.x, B.z, 0.0f)), glm::faceforward(A, B, pvec4(A.y, A.x, B.z, 0.0f)));
+
+			glm::tvec3<float, glm::aligned_highp> const a3(A), b3(B);
+			glm::tvec3<float, glm::packed_highp> const A3(A), B3(B);
+			glm::tvec3<float, glm::aligned_highp> const c3 = glm::cross(a3, b3);
+			glm::tvec3<float, glm::packed_highp> const C3 = glm::cross(A3, B3);
+			Error += check(pvec4(c3, 0.0f), pvec4(C3, 0.0f));
+
+			// only where there is no total internal reflection: the scalar
+			// path returns NaN there, NEON and GLSL return 0
+			pvec4 const N = glm::normalize(B);
+			pvec4 const I = glm::normalize(A);
+			for(int e = 0; e < 3; ++e)
+			{
+				float const Eta = 0.5f + 0.4f * static_cast<float>(e);
+				float const Dot = glm::dot(N, I);
+				if(1.0f - Eta * Eta * (1.0f - Dot * Dot) >= 0.0f)
+					Error += check(glm::refract(avec4(I), avec4(N), Eta), glm::refract(I, N, Eta));
+			}
+		}
+
+		avec4 const Grazing(1.0f, 0.0f, 0.0f, 0.0f);
+		Error += check(glm::refract(Grazing, avec4(0.0f, 1.0f, 0.0f, 0.0f), 2.0f), pvec4(0.0f));
+
+		// the faceforward of a perpendicular reference is -N
+		Error += check(glm::faceforward(Grazing, Grazing, avec4(0.0f, 1.0f, 0.0f, 0.0f)), pvec4(-1.0f, 0.0f, 0.0f, 0.0f));
+
+		return Error;
+	}
+
+	int perf(std::size_t Samples)
+	{
+		std::vector<avec4> A(Samples);
+		std::vector<pvec4> PA(Samples);
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			PA[i] = make_vector(i);
+			A[i] = avec4(PA[i]);
+		}
+
+		float PackedSum = 0.0f, AlignedSum = 0.0f;
+		std::clock_t const StartPacked = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+		for(std::size_t i = 0; i < Samples; ++i)
+			PackedSum += glm::dot(glm::normalize(PA[i]), PA[Samples - 1 - i]);
+		std::clock_t const StartAligned = std::clock();
+		for(int Pass = 0; Pass < 10; ++Pass)
+		for(std::size_t i = 0; i < Samples; ++i)
+			AlignedSum += glm::dot(glm::normalize(A[i]), A[Samples - 1 - i]);
+		std::clock_t const End = std::clock();
+
+		std::printf("dot(normalize) packed: %d clocks\n", static_cast<int>(StartAligned - StartPacked));
+		std::printf("dot(normalize) aligned: %d clocks\n", static_cast<int>(End - StartAligned));
+
+		return check(AlignedSum, PackedSum);
+	}
+}//namespace geometric
+
+namespace matrix
+{
+	int test()
+	{
+		int Error = 0;
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			pmat4 const M = make_matrix(i);
+			pmat4 const N = make_matrix(i + 9);
+			amat4 const m(M), n(N);
+
+			amat4 const t = glm::transpose(m);
+			amat4 const c = glm::matrixCompMult(m, n);
+			amat4 const o = glm::outerProduct(avec4(M[0]), avec4(N[1]));
+			pmat4 const T = glm::transpose(M);
+			pmat4 const C = glm::matrixCompMult(M, N);
+			pmat4 const O = glm::outerProduct(M[0], N[1]);
+			for(glm::length_t k = 0; k < 4; ++k)
+			{
+				Error += check(t[k], T[k]);
+				Error += check(c[k], C[k]);
+				Error += check(o[k], O[k]);
+			}
+
+			Error += check(m * avec4(N[2]), M * N[2]);
+
+			// the sums run in another order than the scalar cofactor expansion
+			float const Det = glm::determinant(M);
+			Error += glm::epsilonEqual(glm::determinant(m), Det, glm::abs(Det) * 1e-5f + 1e-3f) ? 0 : 1;
+
+			amat4 const Inv = glm::inverse(m);
+			pmat4 const InvRef = glm::inverse(M);
+			for(glm::length_t k = 0; k < 4; ++k)
+				Error += glm::all(glm::epsilonEqual(pvec4(Inv[k]), InvRef[k], 1e-4f)) ? 0 : 1;
+
+			amat4 const Identity = m * Inv;
+			for(glm::length_t k = 0; k < 4; ++k)
+				Error += glm::all(glm::epsilonEqual(pvec4(Identity[k]), pmat4(1.0f)[k], 1e-4f)) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int perf(std::size_t Samples)
+	{
+		std::vector<amat4> M(Samples);
+		std::vector<pmat4> PM(Samples);
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			PM[i] = make_matrix(i);
+			M[i] = amat4(PM[i]);
+		}
+
+		float PackedSum = 0.0f, AlignedSum = 0.0f;
+		std::clock_t const StartPacked = std::clock();
+		for(std::size_t i = 0; i < Samples; ++i)
+			PackedSum += glm::inverse(PM[i])[0][0];
+		std::clock_t const StartAligned = std::clock();
+		for(std::size_t i = 0; i < Samples; ++i)
+			AlignedSum += glm::inverse(M[i])[0][0];
+		std::clock_t const End = std::clock();
+
+		std::printf("inverse packed: %d clocks\n", static_cast<int>(StartAligned - StartPacked));
+		std::printf("inverse aligned: %d clocks\n", static_cast<int>(End - StartAligned));
+
+		std::clock_t const StartPackedDet = std::clock();
+		for(std::size_t i = 0; i < Samples; ++i)
+			PackedSum += glm::determinant(PM[i]);
+		std::clock_t const StartAlignedDet = std::clock();
+		for(std::size_t i = 0; i < Samples; ++i)
+			AlignedSum += glm::determinant(M[i]);
+		std::clock_t const EndDet = std::clock();
+
+		std::printf("determinant packed: %d clocks\n", static_cast<int>(StartAlignedDet - StartPackedDet));
+		std::printf("determinant aligned: %d clocks\n", static_cast<int>(EndDet - StartAlignedDet));
+
+		return glm::epsilonEqual(AlignedSum, PackedSum, glm::abs(PackedSum) * 1e-3f) ? 0 : 1;
+	}
+}//namespace matrix
+
+int main()
+{
+	int Error = 0;
+
+	Error += vec4::test_arithmetic();
+	Error += vec4::test_ctor();
+	Error += vec4::test_compare();
+	Error += vec4::test_integer();
+	Error += vec4::test_swizzle();
+	Error += common::test();
+	Error += geometric::test();
+	Error += matrix::test();
+
+#	ifdef NDEBUG
+		std::size_t const Samples = 1 << 18;
+		Error += vec4::perf(Samples);
+		Error += common::perf(Samples);
+		Error += geometric::perf(Samples);
+		Error += matrix::perf(Samples);
+#	endif//NDEBUG
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	std::printf("No NEON code path in this build\n");
+	return 0;
+}
+
+#endif//(GLM_ARCH & GLM_ARCH_NEON_BIT) && GLM_HAS_ALIGNED_TYPE
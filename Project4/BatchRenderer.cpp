@@ -0,0 +1,108 @@
+#include "BatchRenderer.h"
+#include "CommandBuffer.h"
+#include "ShaderReloader.h"
+#include "ShaderSource.h"
+
+#include <string.h>
+
+static const char* vBatchPath = "shaders/batch.vert";
+static const char* fBatchPath = "shaders/batch.frag";
+
+int BatchRenderer::init(ShaderCache* cache, const GLfloat* vertices, GLsizei vertexCount, int capacity) {
+	std::string vert, frag;
+	std::vector<std::string> files;
+	if (!ShaderSource::load(vBatchPath, vert, files) || !ShaderSource::load(fBatchPath, frag, files)) return 1;
+
+	if (shader.compile(vert.c_str(), frag.c_str(), cache)) return 1;
+	uniformAlpha = shader.getUniform("alpha");
+
+	this->vertexCount = vertexCount;
+	this->capacity = capacity;
+
+	glGenVertexArrays(1, &VAO);
+	ProgramState::bindVertexArray(VAO);
+
+	glGenBuffers(1, &meshVBO);
+	glBindBuffer(GL_ARRAY_BUFFER, meshVBO);
+	glBufferData(GL_ARRAY_BUFFER, vertexCount * 3 * sizeof(GLfloat), vertices, GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, 0);
+	glEnableVertexAttribArray(0);
+
+	// pointers are set per frame, they follow the ring section
+	for (GLuint attrib = 1; attrib <= STREAM_COUNT; attrib++) {
+		glEnableVertexAttribArray(attrib);
+		glVertexAttribDivisor(attrib, 1);
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	ProgramState::bindVertexArray(0);
+
+	return instances.init(GL_ARRAY_BUFFER, STREAM_COUNT * capacity * sizeof(GLfloat));
+}
+
+void BatchRenderer::destroy() {
+	glDeleteVertexArrays(1, &VAO);
+	glDeleteBuffers(1, &meshVBO);
+	// the VAO may be the one ProgramState thinks is bound
+	ProgramState::invalidate();
+	instances.destroy();
+	VAO = meshVBO = 0;
+	shader.destroy();
+}
+
+// copies the streams into the next ring section and points the instance
+// attributes at it; returns the number of instances to draw
+int BatchRenderer::upload(const EntityView& view) {
+	int count = view.count < capacity ? view.count : capacity;
+	if (count <= 0) return 0;
+
+	const float* streams[STREAM_COUNT] = { view.x, view.y, view.prevX, view.prevY, view.velX, view.velY };
+	size_t streamSize = capacity * sizeof(GLfloat);
+
+	char* data = (char*)instances.map(STREAM_COUNT * streamSize);
+	if (!data) return 0;
+	for (int stream = 0; stream < STREAM_COUNT; stream++)
+		memcpy(data + stream * streamSize, streams[stream], count * sizeof(GLfloat));
+	size_t base = instances.unmap();
+
+	ProgramState::bindVertexArray(VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, instances.getId());
+	for (GLuint stream = 0; stream < STREAM_COUNT; stream++)
+		glVertexAttribPointer(stream + 1, 1, GL_FLOAT, GL_FALSE, 0, (void*)(base + stream * streamSize));
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	return count;
+}
+
+void BatchRenderer::draw(const EntityView& view, float alpha) {
+	int count = upload(view);
+	if (!count) return;
+
+	shader.use();
+	shader.setFloat(uniformAlpha, alpha);
+	glDrawArraysInstanced(GL_TRIANGLES, 0, vertexCount, count);
+
+	instances.fence();
+}
+
+void BatchRenderer::record(CommandBuffer& commands, int layer, const EntityView& view, float alpha) {
+	int count = upload(view);
+	if (!count) return;
+
+	commands.drawInstanced(CommandBuffer::makeKey(layer, shader.getId(), VAO, 0), shader, VAO, GL_TRIANGLES, 0, vertexCount, count);
+	commands.setFloat(uniformAlpha, alpha);
+	pending = true;
+}
+
+void BatchRenderer::fence() {
+	if (!pending) return;
+	instances.fence();
+	pending = false;
+}
+
+void BatchRenderer::watch(ShaderReloader& reloader) {
+	reloader.add(shader, vBatchPath, fBatchPath, [this] { uniformAlpha = shader.getUniform("alpha"); });
+}
+
+int BatchRenderer::getCapacity() {
+	return capacity;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <GL/glew.h>
+
+#include "EntityStore.h"
+#include "Shader.h"
+#include "StreamBuffer.h"
+
+class CommandBuffer;
+class ShaderCache;
+class ShaderReloader;
+
+// Draws many copies of one mesh with a single glDrawArraysInstanced.
+// The entity streams are copied as-is into a section of a streaming
+// ring buffer, one region per stream, and read with a divisor of 1.
+class BatchRenderer {
+private:
+	// instance data regions, in attribute order starting at location 1
+	enum Stream { OFFSET_X, OFFSET_Y, PREV_X, PREV_Y, VEL_X, VEL_Y, STREAM_COUNT };
+
+	Shader shader;
+	int uniformAlpha = -1;
+	GLuint VAO = 0;
+	GLuint meshVBO = 0;
+	StreamBuffer instances;
+	GLsizei vertexCount = 0;
+	int capacity = 0;
+	bool pending = false; // recorded draw not fenced yet
+
+	int upload(const EntityView& view);
+
+public:
+	int init(ShaderCache* cache, const GLfloat* vertices, GLsizei vertexCount, int capacity);
+	void destroy();
+
+	// alpha interpolates between the previous and current positions
+	void draw(const EntityView& view, float alpha);
+
+	// uploads the instances now and records the draw; at most once per
+	// frame, call fence() after the buffer was executed
+	void record(CommandBuffer& commands, int layer, const EntityView& view, float alpha);
+	void fence();
+	// rebuild the shaders when their files change
+	void watch(ShaderReloader& reloader);
+
+	int getCapacity();
+};
@@ -0,0 +1,122 @@
+#include "Benchmarks.h"
+
+#include <stdio.h>
+#include <chrono>
+
+#include "BatchRenderer.h"
+#include "EntityStore.h"
+#include "GLRecorder.h"
+#include "GameWindow.h"
+#include "JobSystem.h"
+
+typedef std::chrono::steady_clock BenchClock;
+
+static double elapsedMs(BenchClock::time_point start) {
+	return std::chrono::duration<double, std::milli>(BenchClock::now() - start).count();
+}
+
+// one simulated + rendered frame, glFinish so the GPU cost is included
+static double benchFrame(GameWindow& window, BatchRenderer& batch, EntityStore& entities) {
+	BenchClock::time_point start = BenchClock::now();
+
+	glfwPollEvents();
+	entities.update(1.0f / 120.0f);
+
+	glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+	glClear(GL_COLOR_BUFFER_BIT);
+	batch.draw(entities.view(), 1.0f);
+	window.swapBuffers();
+	glFinish();
+
+	return elapsedMs(start);
+}
+
+// 1000, 10000, ... and then the capacity itself when the last step
+// fell short of it; 0 once the capacity has been measured
+static int nextCount(int count, int capacity) {
+	if (count >= capacity) return 0;
+	long long next = (long long)count * 10;
+	return next < capacity ? (int)next : capacity;
+}
+
+int RunInstanceBenchmark(GameWindow& window, BatchRenderer& batch, EntityStore& entities, int framesPerStep) {
+	const int warmupFrames = 10;
+
+	// the benchmark measures the renderer, not the display
+	window.setPresentMode(GameWindow::PRESENT_UNCAPPED);
+
+	printf("%12s %10s %10s %10s %14s\n", "instances", "avg ms", "min ms", "max ms", "instances/s");
+	int capacity = batch.getCapacity();
+	for (int count = capacity < 1000 ? capacity : 1000; count > 0; count = nextCount(count, capacity)) {
+		entities.spawn(count, 1234u);
+
+		for (int i = 0; i < warmupFrames; i++)
+			benchFrame(window, batch, entities);
+
+		double total = 0.0, minMs = 1e9, maxMs = 0.0;
+		for (int i = 0; i < framesPerStep; i++) {
+			if (window.shouldClose()) return 1;
+
+			double ms = benchFrame(window, batch, entities);
+			total += ms;
+			if (ms < minMs) minMs = ms;
+			if (ms > maxMs) maxMs = ms;
+		}
+
+		double avg = total / framesPerStep;
+		printf("%12d %10.3f %10.3f %10.3f %14.0f\n", count, avg, minMs, maxMs, count / (avg / 1000.0));
+	}
+	return 0;
+}
+
+enum UpdatePath { SCALAR, SIMD, SIMD_JOBS };
+
+// best of three runs, in entities per second
+static double benchUpdate(EntityStore& entities, JobSystem& jobs, int steps, UpdatePath path) {
+	double best = 0.0;
+	for (int run = 0; run < 3; run++) {
+		entities.spawn(entities.getCount(), 1234u);
+
+		BenchClock::time_point start = BenchClock::now();
+		for (int i = 0; i < steps; i++) {
+			if (path == SCALAR) entities.updateScalar(1.0f / 120.0f);
+			else if (path == SIMD) entities.update(1.0f / 120.0f);
+			else jobs.parallelFor(entities.getCount(), 16384, EntityStore::LANES,
+				[&entities](int begin, int end) { entities.update(begin, end, 1.0f / 120.0f); });
+		}
+		double seconds = elapsedMs(start) / 1000.0;
+
+		double rate = (double)entities.getCount() * steps / seconds;
+		if (rate > best) best = rate;
+	}
+	return best;
+}
+
+int RunEntityBenchmark(EntityStore& entities, JobSystem& jobs, int stepsPerCount) {
+	printf("%d worker threads\n", jobs.getThreadCount());
+	printf("%12s %16s %16s %16s %8s\n", "entities", "scalar ent/s", "simd ent/s", "jobs ent/s", "speedup");
+	int capacity = entities.getCapacity();
+	for (int count = capacity < 1000 ? capacity : 1000; count > 0; count = nextCount(count, capacity)) {
+		entities.spawn(count, 1234u);
+
+		// keep the total work per count roughly constant
+		int steps = stepsPerCount * 1000 / count;
+		if (steps < 3) steps = 3;
+
+		double scalar = benchUpdate(entities, jobs, steps, SCALAR);
+		double simd = benchUpdate(entities, jobs, steps, SIMD);
+		double threaded = benchUpdate(entities, jobs, steps, SIMD_JOBS);
+		printf("%12d %16.0f %16.0f %16.0f %7.2fx\n", count, scalar, simd, threaded, threaded / scalar);
+	}
+	return 0;
+}
+
+int RunReplayBenchmark(GameWindow& window, const std::string& path, int loops) {
+	GLRecorder::ReplayStats stats;
+	if (GLRecorder::replay(path, window.getDefaultFramebuffer(), loops, stats)) return 1;
+
+	printf("Replayed %d frames, %.1f calls per frame\n", stats.frames, stats.callsPerFrame);
+	printf("Submit mean %.3f ms, p95 %.3f ms, max %.3f ms, %.0f ns per call; finish mean %.3f ms\n",
+		stats.submitMeanMs, stats.submitP95Ms, stats.submitMaxMs, stats.nsPerCall, stats.finishMeanMs);
+	return 0;
+}
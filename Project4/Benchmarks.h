@@ -0,0 +1,21 @@
+#pragma once
+
+#include <string>
+
+class BatchRenderer;
+class EntityStore;
+class GameWindow;
+class JobSystem;
+
+// Renders 1k, 10k, 100k... instances up to the batch capacity and
+// prints the frame time for each count. Returns 0 on success.
+int RunInstanceBenchmark(GameWindow& window, BatchRenderer& batch, EntityStore& entities, int framesPerStep);
+
+// Steps 1k, 10k... entities up to the store capacity with the scalar,
+// the SIMD and the SIMD update spread over the job system, and prints
+// entities per second. Needs no GL.
+int RunEntityBenchmark(EntityStore& entities, JobSystem& jobs, int stepsPerCount);
+
+// Replays a log written with GLRecorder (frames after the first, loops
+// times) and prints the CPU time spent issuing each frame's calls.
+int RunReplayBenchmark(GameWindow& window, const std::string& path, int loops);
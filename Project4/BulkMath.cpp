@@ -0,0 +1,133 @@
+#include "BulkMath.h"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/noise.hpp>
+#include <glm/gtc/packing.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define BULKMATH_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+#ifdef BULKMATH_X86
+// defined in BulkMath_<isa>.cpp, each built for its own ISA
+extern const BulkMath::Kernels bulkMathSse2;
+extern const BulkMath::Kernels bulkMathAvx2;
+extern const BulkMath::Kernels bulkMathAvx512;
+#endif
+
+// per element GLM, the reference and the fallback off x86
+static void transformGeneric(const float m[16], const float* in, float* out, size_t count) {
+	glm::mat4 matrix = glm::make_mat4(m);
+	for (size_t i = 0; i < count; i++) {
+		glm::vec4 v = matrix * glm::make_vec4(in + i * 4);
+		for (int c = 0; c < 4; c++) out[i * 4 + c] = v[c];
+	}
+}
+
+static void normalizeGeneric(const float* in, float* out, size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		glm::vec4 v = glm::normalize(glm::make_vec4(in + i * 4));
+		for (int c = 0; c < 4; c++) out[i * 4 + c] = v[c];
+	}
+}
+
+static void packUnorm4x8Generic(const float* in, uint32_t* out, size_t count) {
+	for (size_t i = 0; i < count; i++)
+		out[i] = glm::packUnorm4x8(glm::make_vec4(in + i * 4));
+}
+
+static void simplex2Generic(const float* x, const float* y, float* out, size_t count) {
+	for (size_t i = 0; i < count; i++)
+		out[i] = glm::simplex(glm::vec2(x[i], y[i]));
+}
+
+static const BulkMath::Kernels bulkMathGeneric = {
+	BulkMath::GENERIC, transformGeneric, normalizeGeneric, packUnorm4x8Generic, simplex2Generic
+};
+
+#ifdef BULKMATH_X86
+static void cpuid(int leaf, unsigned int regs[4]) {
+#ifdef _MSC_VER
+	__cpuidex((int*)regs, leaf, 0);
+#else
+	__cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+// register state the OS saves on context switches (XCR0)
+static unsigned long long xgetbv() {
+#ifdef _MSC_VER
+	return _xgetbv(0);
+#else
+	unsigned int lo, hi;
+	__asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+	return ((unsigned long long)hi << 32) | lo;
+#endif
+}
+
+static BulkMath::Isa probe() {
+	unsigned int regs[4];
+	cpuid(0, regs);
+	unsigned int maxLeaf = regs[0];
+
+	cpuid(1, regs);
+	bool sse2 = (regs[3] & (1u << 26)) != 0;
+	bool fma = (regs[2] & (1u << 12)) != 0;
+	bool osxsave = (regs[2] & (1u << 27)) != 0;
+	bool avx = (regs[2] & (1u << 28)) != 0;
+	if (!sse2) return BulkMath::GENERIC;
+	if (!osxsave || !avx || maxLeaf < 7) return BulkMath::SSE2;
+
+	unsigned long long xcr0 = xgetbv();
+	bool ymmState = (xcr0 & 0x06) == 0x06;
+	bool zmmState = (xcr0 & 0xE6) == 0xE6;
+
+	cpuid(7, regs);
+	unsigned int ebx = regs[1];
+	bool avx2 = (ebx & (1u << 5)) != 0;
+	// F, DQ, CD, BW, VL, the subset the AVX-512 unit is built for
+	const unsigned int avx512Bits = (1u << 16) | (1u << 17) | (1u << 28) | (1u << 30) | (1u << 31);
+
+	if (zmmState && (ebx & avx512Bits) == avx512Bits) return BulkMath::AVX512;
+	if (ymmState && avx2 && fma) return BulkMath::AVX2;
+	return BulkMath::SSE2;
+}
+#endif
+
+BulkMath::Isa BulkMath::detect() {
+#ifdef BULKMATH_X86
+	static const Isa isa = probe();
+	return isa;
+#else
+	return GENERIC;
+#endif
+}
+
+const char* BulkMath::getName(Isa isa) {
+	static const char* const names[ISA_COUNT] = { "generic", "sse2", "avx2", "avx512" };
+	return isa >= 0 && isa < ISA_COUNT ? names[isa] : "unknown";
+}
+
+const BulkMath::Kernels* BulkMath::get(Isa isa) {
+	if (isa > detect()) return NULL;
+	switch (isa) {
+	case GENERIC: return &bulkMathGeneric;
+#ifdef BULKMATH_X86
+	case SSE2: return &bulkMathSse2;
+	case AVX2: return &bulkMathAvx2;
+	case AVX512: return &bulkMathAvx512;
+#endif
+	default: return NULL;
+	}
+}
+
+const BulkMath::Kernels& BulkMath::get() {
+	static const Kernels* const best = get(detect());
+	return *best;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Batched math over arrays, dispatched at runtime. Every kernel is built
+// once per instruction set in its own translation unit (BulkMath_sse2,
+// _avx2 and _avx512.cpp, compiled with that ISA's flags) and the widest
+// set the CPU and OS support is read through cpuid once, so a single
+// binary runs on any x86-64 host and uses AVX2 or AVX-512 where present.
+class BulkMath {
+public:
+	enum Isa { GENERIC, SSE2, AVX2, AVX512, ISA_COUNT };
+
+	// all arrays are tightly packed and need no alignment
+	struct Kernels {
+		Isa isa;
+		// out[i] = m * in[i] for vec4s, m is a column-major mat4
+		void (*transform)(const float m[16], const float* in, float* out, size_t count);
+		// out[i] = normalize(in[i]) for vec4s
+		void (*normalize)(const float* in, float* out, size_t count);
+		// out[i] = glm::packUnorm4x8(in[i]), RGBA8 colors from vec4s
+		void (*packUnorm4x8)(const float* in, uint32_t* out, size_t count);
+		// out[i] = glm::simplex(vec2(x[i], y[i]))
+		void (*simplex2)(const float* x, const float* y, float* out, size_t count);
+	};
+
+	// widest ISA this build and host support, probed once
+	static Isa detect();
+	static const char* getName(Isa isa);
+
+	// kernels of isa, NULL if this build or the host doesn't have it
+	static const Kernels* get(Isa isa);
+	// kernels of detect()
+	static const Kernels& get();
+};
@@ -0,0 +1,117 @@
+#pragma once
+
+// Kernels shared by the BulkMath_<isa>.cpp units, written once against
+// a lane type each unit defines for its ISA before including this:
+//
+//   WIDTH, F (floats), M (compare mask), load, store, set, add, sub,
+//   mul, div, max, abs, floor, gt, select(mask, ifTrue, ifFalse)
+//
+// Everything has internal linkage so every unit keeps its own copy,
+// compiled with its own flags. Nothing here may be inline with external
+// linkage: the linker would keep one ISA's copy for all callers.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace {
+
+template <typename V>
+typename V::F mod289(typename V::F x) {
+	return V::sub(x, V::mul(V::floor(V::mul(x, V::set(1.0f / 289.0f))), V::set(289.0f)));
+}
+
+template <typename V>
+typename V::F permute(typename V::F x) {
+	return mod289<V>(V::mul(V::add(V::mul(x, V::set(34.0f)), V::set(1.0f)), x));
+}
+
+// falloff^4 * (gradient . offset) of one simplex corner; the gradients
+// are 41 points on a line mapped onto a diamond
+template <typename V>
+typename V::F simplexCorner(typename V::F p, typename V::F x, typename V::F y) {
+	typedef typename V::F F;
+	F const half = V::set(0.5f);
+
+	F m = V::max(V::sub(half, V::add(V::mul(x, x), V::mul(y, y))), V::set(0.0f));
+	m = V::mul(m, m);
+	m = V::mul(m, m);
+
+	F t = V::mul(p, V::set(1.0f / 41.0f));
+	F gx = V::sub(V::mul(V::set(2.0f), V::sub(t, V::floor(t))), V::set(1.0f));
+	F h = V::sub(V::abs(gx), half);
+	F a0 = V::sub(gx, V::floor(V::add(gx, half)));
+
+	// normalizes the gradient through m, taylorInvSqrt(a0^2 + h^2)
+	F lengthSq = V::add(V::mul(a0, a0), V::mul(h, h));
+	m = V::mul(m, V::sub(V::set(1.79284291400159f), V::mul(V::set(0.85373472095314f), lengthSq)));
+	return V::mul(m, V::add(V::mul(a0, x), V::mul(h, y)));
+}
+
+// glm::simplex(vec2) for WIDTH points at once
+template <typename V>
+typename V::F simplex2(typename V::F x, typename V::F y) {
+	typedef typename V::F F;
+	F const cx = V::set(0.211324865405187f);  // (3 - sqrt(3)) / 6
+	F const cy = V::set(0.366025403784439f);  // (sqrt(3) - 1) / 2
+	F const cz = V::set(-0.577350269189626f); // 2 * cx - 1
+	F const one = V::set(1.0f);
+
+	// first corner, in glm's order of operations: far from the origin
+	// the rounding of every step shows in the result
+	F s = V::add(V::mul(x, cy), V::mul(y, cy));
+	F ix = V::floor(V::add(x, s));
+	F iy = V::floor(V::add(y, s));
+	F t = V::add(V::mul(ix, cx), V::mul(iy, cx));
+	F x0 = V::add(V::sub(x, ix), t);
+	F y0 = V::add(V::sub(y, iy), t);
+
+	// the middle corner depends on which half of the cell we're in
+	F i1x = V::select(V::gt(x0, y0), one, V::set(0.0f));
+	F i1y = V::sub(one, i1x);
+	F x1 = V::sub(V::add(x0, cx), i1x);
+	F y1 = V::sub(V::add(y0, cx), i1y);
+	F x2 = V::add(x0, cz);
+	F y2 = V::add(y0, cz);
+
+	// glm::mod(i, 289), divides where mod289 multiplies
+	F const ring = V::set(289.0f);
+	ix = V::sub(ix, V::mul(ring, V::floor(V::div(ix, ring))));
+	iy = V::sub(iy, V::mul(ring, V::floor(V::div(iy, ring))));
+	F p0 = permute<V>(V::add(permute<V>(iy), ix));
+	F p1 = permute<V>(V::add(permute<V>(V::add(iy, i1y)), V::add(ix, i1x)));
+	F p2 = permute<V>(V::add(permute<V>(V::add(iy, one)), V::add(ix, one)));
+
+	F n = V::add(V::add(simplexCorner<V>(p0, x0, y0), simplexCorner<V>(p1, x1, y1)), simplexCorner<V>(p2, x2, y2));
+	return V::mul(V::set(130.0f), n);
+}
+
+template <typename V>
+void simplex2Kernel(const float* x, const float* y, float* out, size_t count) {
+	size_t i = 0;
+	for (; i + V::WIDTH <= count; i += V::WIDTH)
+		V::store(out + i, simplex2<V>(V::load(x + i), V::load(y + i)));
+
+	// the tail goes through padded copies
+	if (i < count) {
+		float tx[V::WIDTH] = {}, ty[V::WIDTH] = {}, to[V::WIDTH];
+		size_t left = count - i;
+		memcpy(tx, x + i, left * sizeof(float));
+		memcpy(ty, y + i, left * sizeof(float));
+		V::store(to, simplex2<V>(V::load(tx), V::load(ty)));
+		memcpy(out + i, to, left * sizeof(float));
+	}
+}
+
+// clamp, scale and round the way the vector pack kernels do, NaN packs to 0
+inline uint32_t packUnorm4x8Scalar(const float* v) {
+	uint32_t packed = 0;
+	for (int c = 0; c < 4; c++) {
+		float f = v[c] > 0.0f ? v[c] : 0.0f;
+		f = f < 1.0f ? f : 1.0f;
+		packed |= (uint32_t)(f * 255.0f + 0.5f) << (c * 8);
+	}
+	return packed;
+}
+
+} // namespace
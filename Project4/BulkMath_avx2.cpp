@@ -0,0 +1,82 @@
+// BulkMath kernels for AVX2 + FMA, built with -mavx2 -mfma or
+// /arch:AVX2, see BulkMathKernels.h for the linkage rules.
+
+// GLM's simd functions get internal linkage, an out-of-line copy
+// (MSVC Debug ignores __forceinline) could otherwise be shared with the
+// units built for other ISAs
+#define GLM_FORCE_INLINE
+#define GLM_FORCE_SIMD_STATIC
+#include <glm/detail/setup.hpp>
+#include <glm/simd/batch.h>
+
+#include "BulkMath.h"
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+namespace {
+
+struct Lanes {
+	static const int WIDTH = 8;
+	typedef __m256 F;
+	typedef __m256 M;
+
+	static F load(const float* p) { return _mm256_loadu_ps(p); }
+	static void store(float* p, F v) { _mm256_storeu_ps(p, v); }
+	static F set(float s) { return _mm256_set1_ps(s); }
+	static F add(F a, F b) { return _mm256_add_ps(a, b); }
+	static F sub(F a, F b) { return _mm256_sub_ps(a, b); }
+	static F mul(F a, F b) { return _mm256_mul_ps(a, b); }
+	static F div(F a, F b) { return _mm256_div_ps(a, b); }
+	static F max(F a, F b) { return _mm256_max_ps(a, b); }
+	static F abs(F a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+	static F floor(F a) { return _mm256_floor_ps(a); }
+	static M gt(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+	static F select(M m, F a, F b) { return _mm256_blendv_ps(b, a, m); }
+};
+
+} // namespace
+
+#include "BulkMathKernels.h"
+
+namespace {
+
+void transform(const float m[16], const float* in, float* out, size_t count) {
+	glm_mat4_mul_vec4_batch(m, in, out, count);
+}
+
+void normalize(const float* in, float* out, size_t count) {
+	glm_vec4_normalize_batch(in, out, count);
+}
+
+// 8 colors per iteration. The packs work within 128-bit lanes, which
+// leaves the colors in the order 0 2 4 6 1 3 5 7 for the final permute.
+void packUnorm4x8(const float* in, uint32_t* out, size_t count) {
+	__m256 const zero = _mm256_setzero_ps();
+	__m256 const one = _mm256_set1_ps(1.0f);
+	__m256 const scale = _mm256_set1_ps(255.0f);
+	__m256 const half = _mm256_set1_ps(0.5f);
+	__m256i const order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256i c[4];
+		for (int k = 0; k < 4; k++) {
+			__m256 v = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(in + (i + k * 2) * 4), zero), one);
+			c[k] = _mm256_cvttps_epi32(_mm256_fmadd_ps(v, scale, half));
+		}
+		__m256i lo = _mm256_packs_epi32(c[0], c[1]);
+		__m256i hi = _mm256_packs_epi32(c[2], c[3]);
+		__m256i packed = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(lo, hi), order);
+		_mm256_storeu_si256((__m256i*)(out + i), packed);
+	}
+	for (; i < count; i++)
+		out[i] = packUnorm4x8Scalar(in + i * 4);
+}
+
+} // namespace
+
+extern const BulkMath::Kernels bulkMathAvx2 = {
+	BulkMath::AVX2, transform, normalize, packUnorm4x8, simplex2Kernel<Lanes>
+};
+
+#endif
@@ -0,0 +1,76 @@
+// BulkMath kernels for AVX-512 (F, CD, BW, DQ, VL), built with the
+// matching -mavx512* flags or /arch:AVX512, see BulkMathKernels.h for
+// the linkage rules.
+
+// GLM's simd functions get internal linkage, an out-of-line copy
+// (MSVC Debug ignores __forceinline) could otherwise be shared with the
+// units built for other ISAs
+#define GLM_FORCE_INLINE
+#define GLM_FORCE_SIMD_STATIC
+#include <glm/detail/setup.hpp>
+#include <glm/simd/batch.h>
+
+#include "BulkMath.h"
+
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+namespace {
+
+struct Lanes {
+	static const int WIDTH = 16;
+	typedef __m512 F;
+	typedef __mmask16 M;
+
+	static F load(const float* p) { return _mm512_loadu_ps(p); }
+	static void store(float* p, F v) { _mm512_storeu_ps(p, v); }
+	static F set(float s) { return _mm512_set1_ps(s); }
+	static F add(F a, F b) { return _mm512_add_ps(a, b); }
+	static F sub(F a, F b) { return _mm512_sub_ps(a, b); }
+	static F mul(F a, F b) { return _mm512_mul_ps(a, b); }
+	static F div(F a, F b) { return _mm512_div_ps(a, b); }
+	static F max(F a, F b) { return _mm512_max_ps(a, b); }
+	static F abs(F a) { return _mm512_abs_ps(a); }
+	static F floor(F a) { return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+	static M gt(F a, F b) { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+	static F select(M m, F a, F b) { return _mm512_mask_blend_ps(m, b, a); }
+};
+
+} // namespace
+
+#include "BulkMathKernels.h"
+
+namespace {
+
+void transform(const float m[16], const float* in, float* out, size_t count) {
+	glm_mat4_mul_vec4_batch(m, in, out, count);
+}
+
+void normalize(const float* in, float* out, size_t count) {
+	glm_vec4_normalize_batch(in, out, count);
+}
+
+// 4 colors per register, narrowed to bytes by a saturating convert;
+// the tail is masked
+void packUnorm4x8(const float* in, uint32_t* out, size_t count) {
+	__m512 const zero = _mm512_setzero_ps();
+	__m512 const one = _mm512_set1_ps(1.0f);
+	__m512 const scale = _mm512_set1_ps(255.0f);
+	__m512 const half = _mm512_set1_ps(0.5f);
+
+	for (size_t i = 0; i < count; i += 4) {
+		size_t left = count - i;
+		__mmask16 mask = left >= 4 ? (__mmask16)0xFFFF : (__mmask16)((1u << (left * 4)) - 1);
+		__m512 v = _mm512_maskz_loadu_ps(mask, in + i * 4);
+		v = _mm512_min_ps(_mm512_max_ps(v, zero), one);
+		__m512i c = _mm512_cvttps_epi32(_mm512_fmadd_ps(v, scale, half));
+		_mm512_mask_cvtusepi32_storeu_epi8(out + i, mask, c);
+	}
+}
+
+} // namespace
+
+extern const BulkMath::Kernels bulkMathAvx512 = {
+	BulkMath::AVX512, transform, normalize, packUnorm4x8, simplex2Kernel<Lanes>
+};
+
+#endif
@@ -0,0 +1,158 @@
+#include "CommandBuffer.h"
+#include "GLRecorder.h"
+#include "Shader.h"
+
+#include <string.h>
+
+CommandBuffer::SortKey CommandBuffer::makeKey(int layer, GLuint program, GLuint vao, unsigned int sequence) {
+	// GL names are small integers, 20 bits are plenty to tell them apart
+	return ((SortKey)(layer & 0xff) << 56)
+		| ((SortKey)(program & 0xfffff) << 36)
+		| ((SortKey)(vao & 0xfffff) << 16)
+		| (SortKey)(sequence & 0xffff);
+}
+
+void CommandBuffer::clear() {
+	keys.clear();
+	packets.clear();
+	uniforms.clear();
+	order.clear();
+	sorted = false;
+}
+
+void CommandBuffer::draw(SortKey key, Shader& shader, GLuint vao, GLenum mode, GLint first, GLsizei count) {
+	drawInstanced(key, shader, vao, mode, first, count, 0);
+}
+
+void CommandBuffer::drawInstanced(SortKey key, Shader& shader, GLuint vao, GLenum mode, GLint first, GLsizei count, GLsizei instances) {
+	Packet packet = { &shader, vao, mode, first, count, instances, (int)uniforms.size(), 0 };
+	keys.push_back(key);
+	packets.push_back(packet);
+	sorted = false;
+}
+
+CommandBuffer::Uniform& CommandBuffer::addUniform(int handle, int components) {
+	Uniform uniform;
+	uniform.handle = handle;
+	uniform.components = components;
+	memset(&uniform.value, 0, sizeof(uniform.value));
+	uniforms.push_back(uniform);
+	packets.back().uniformCount++;
+	return uniforms.back();
+}
+
+void CommandBuffer::setInt(int uniform, GLint value) {
+	if (uniform < 0 || packets.empty()) return;
+	addUniform(uniform, 0).value.i = value;
+}
+
+void CommandBuffer::setFloat(int uniform, GLfloat value) {
+	if (uniform < 0 || packets.empty()) return;
+	addUniform(uniform, 1).value.f[0] = value;
+}
+
+void CommandBuffer::setVec2(int uniform, GLfloat x, GLfloat y) {
+	if (uniform < 0 || packets.empty()) return;
+	Uniform& slot = addUniform(uniform, 2);
+	slot.value.f[0] = x;
+	slot.value.f[1] = y;
+}
+
+void CommandBuffer::setVec4(int uniform, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	if (uniform < 0 || packets.empty()) return;
+	Uniform& slot = addUniform(uniform, 4);
+	slot.value.f[0] = x;
+	slot.value.f[1] = y;
+	slot.value.f[2] = z;
+	slot.value.f[3] = w;
+}
+
+void CommandBuffer::append(CommandBuffer& other) {
+	int uniformBase = (int)uniforms.size();
+	for (Packet packet : other.packets) {
+		packet.firstUniform += uniformBase;
+		packets.push_back(packet);
+	}
+	keys.insert(keys.end(), other.keys.begin(), other.keys.end());
+	uniforms.insert(uniforms.end(), other.uniforms.begin(), other.uniforms.end());
+	other.clear();
+	sorted = false;
+}
+
+// Sorts packet indices by key, one byte per pass starting with the
+// lowest. Passes where every key has the same byte are skipped, which
+// is most of them: layers and sequence numbers rarely use all bits.
+void CommandBuffer::sort() {
+	int count = (int)packets.size();
+	sortKeys = keys;
+	tempKeys.resize(count);
+	order.resize(count);
+	tempOrder.resize(count);
+	for (int i = 0; i < count; i++) order[i] = i;
+
+	for (int shift = 0; shift < 64; shift += 8) {
+		int histogram[257] = { 0 };
+		for (int i = 0; i < count; i++)
+			histogram[((sortKeys[i] >> shift) & 0xff) + 1]++;
+		if (count == 0 || histogram[((sortKeys[0] >> shift) & 0xff) + 1] == count) continue;
+
+		for (int b = 0; b < 256; b++)
+			histogram[b + 1] += histogram[b];
+
+		// stable scatter keeps the order of earlier passes
+		for (int i = 0; i < count; i++) {
+			int slot = histogram[(sortKeys[i] >> shift) & 0xff]++;
+			tempKeys[slot] = sortKeys[i];
+			tempOrder[slot] = order[i];
+		}
+		sortKeys.swap(tempKeys);
+		order.swap(tempOrder);
+	}
+	sorted = true;
+}
+
+void CommandBuffer::execute() {
+	stats.packets = (int)packets.size();
+	stats.programSwitches = 0;
+	stats.vaoSwitches = 0;
+
+	GLuint program = 0;
+	GLuint vao = 0;
+	for (int i = 0; i < (int)packets.size(); i++) {
+		const Packet& packet = packets[sorted ? order[i] : i];
+		Shader& shader = *packet.shader;
+
+		if (shader.getId() != program) {
+			program = shader.getId();
+			stats.programSwitches++;
+		}
+		if (packet.vao != vao) {
+			vao = packet.vao;
+			stats.vaoSwitches++;
+		}
+		shader.use();
+		ProgramState::bindVertexArray(packet.vao);
+
+		for (int u = packet.firstUniform; u < packet.firstUniform + packet.uniformCount; u++) {
+			const Uniform& uniform = uniforms[u];
+			const GLfloat* f = uniform.value.f;
+			switch (uniform.components) {
+			case 0: shader.setInt(uniform.handle, uniform.value.i); break;
+			case 1: shader.setFloat(uniform.handle, f[0]); break;
+			case 2: shader.setVec2(uniform.handle, f[0], f[1]); break;
+			case 4: shader.setVec4(uniform.handle, f[0], f[1], f[2], f[3]); break;
+			}
+		}
+
+		if (packet.instances > 0) glDrawArraysInstanced(packet.mode, packet.first, packet.count, packet.instances);
+		else glDrawArrays(packet.mode, packet.first, packet.count);
+	}
+}
+
+int CommandBuffer::getCount() {
+	return (int)packets.size();
+}
+
+CommandBuffer::Stats CommandBuffer::getStats() {
+	return stats;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <vector>
+
+class Shader;
+
+// Draws recorded as packets and submitted later in key order. Keys put
+// the layer first, then program, then VAO, so after sorting, packets
+// sharing a program and VAO run back to back and ProgramState skips
+// the repeated binds. Uniform values travel with the packet and go
+// through Shader's upload cache, so unchanged values cost nothing.
+//
+// A CommandBuffer is not thread safe; give every recording thread its
+// own and append() them into one before sort().
+class CommandBuffer {
+public:
+	// layer (8 bits) | program (20) | VAO (20) | sequence (16)
+	typedef unsigned long long SortKey;
+
+	struct Stats {
+		int packets;
+		int programSwitches;
+		int vaoSwitches;
+	};
+
+private:
+	struct Uniform {
+		int handle;
+		int components; // 0 for int
+		union {
+			GLfloat f[4];
+			GLint i;
+		} value;
+	};
+
+	struct Packet {
+		Shader* shader;
+		GLuint vao;
+		GLenum mode;
+		GLint first;
+		GLsizei count;
+		GLsizei instances; // 0 for a non-instanced draw
+		int firstUniform;
+		int uniformCount;
+	};
+
+	std::vector<SortKey> keys;
+	std::vector<Packet> packets;
+	std::vector<Uniform> uniforms;
+
+	// radix sort scratch, (key, packet) pairs
+	std::vector<SortKey> sortKeys;
+	std::vector<SortKey> tempKeys;
+	std::vector<int> order;
+	std::vector<int> tempOrder;
+	bool sorted = false;
+
+	Stats stats = { 0, 0, 0 };
+
+	Uniform& addUniform(int handle, int components);
+
+public:
+	static SortKey makeKey(int layer, GLuint program, GLuint vao, unsigned int sequence);
+
+	void clear();
+
+	// starts a packet; its uniforms follow until the next draw
+	void draw(SortKey key, Shader& shader, GLuint vao, GLenum mode, GLint first, GLsizei count);
+	void drawInstanced(SortKey key, Shader& shader, GLuint vao, GLenum mode, GLint first, GLsizei count, GLsizei instances);
+
+	// handles from Shader::getUniform, -1 is ignored
+	void setInt(int uniform, GLint value);
+	void setFloat(int uniform, GLfloat value);
+	void setVec2(int uniform, GLfloat x, GLfloat y);
+	void setVec4(int uniform, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
+
+	// moves in the packets of another (e.g. per-thread) buffer
+	void append(CommandBuffer& other);
+
+	// LSD radix sort over the key bytes that actually differ
+	void sort();
+	// runs the packets, sorted if sort() was called
+	void execute();
+
+	int getCount();
+	Stats getStats();
+};
@@ -0,0 +1,207 @@
+#include "EntityStore.h"
+
+#include <cmath>
+#include <random>
+#include <stdint.h>
+#include <string.h>
+
+#include <glm/glm.hpp>
+#include <glm/simd/common.h>
+
+int EntityStore::init(int capacity) {
+	this->capacity = (capacity + LANES - 1) / LANES * LANES;
+	count = 0;
+
+	// one allocation for all streams, base aligned by hand
+	size_t streamSize = (size_t)this->capacity;
+	storage.assign(streamSize * STREAM_COUNT + LANES, 0.0f);
+
+	uintptr_t base = (uintptr_t)storage.data();
+	base = (base + ALIGNMENT - 1) & ~(uintptr_t)(ALIGNMENT - 1);
+	for (int i = 0; i < STREAM_COUNT; i++)
+		streams[i] = (float*)base + i * streamSize;
+
+	// padding lanes never move and never bounce
+	for (int i = 0; i < this->capacity; i++) {
+		streams[BOUND_X][i] = 1.0f;
+		streams[BOUND_Y][i] = 1.0f;
+	}
+	return 0;
+}
+
+void EntityStore::spawn(int count, unsigned int seed) {
+	if (count > capacity) count = capacity;
+	this->count = count;
+
+	std::mt19937 random(seed);
+	std::uniform_real_distribution<float> offset(-0.9f, 0.9f);
+	std::uniform_real_distribution<float> speed(0.1f, 0.6f);
+
+	for (int i = 0; i < capacity; i++) {
+		bool alive = i < count;
+		streams[POS_X][i] = alive ? offset(random) : 0.0f;
+		streams[POS_Y][i] = alive ? offset(random) : 0.0f;
+		streams[VEL_X][i] = alive ? speed(random) * ((random() & 1) ? 1.0f : -1.0f) : 0.0f;
+		streams[VEL_Y][i] = alive ? speed(random) * ((random() & 1) ? 1.0f : -1.0f) : 0.0f;
+		streams[BOUND_X][i] = alive ? 0.9f : 1.0f;
+		streams[BOUND_Y][i] = alive ? 0.9f : 1.0f;
+	}
+	memcpy(streams[PREV_X], streams[POS_X], capacity * sizeof(float));
+	memcpy(streams[PREV_Y], streams[POS_Y], capacity * sizeof(float));
+}
+
+void EntityStore::update(float dt) {
+	update(0, count, dt);
+}
+
+// p += v * dt; v flips sign once |p| reaches the bound.
+// The flip is an xor of the sign bit under the compare mask.
+void EntityStore::update(int begin, int end, float dt) {
+	float* px = streams[POS_X];
+	float* py = streams[POS_Y];
+	float* qx = streams[PREV_X];
+	float* qy = streams[PREV_Y];
+	float* vx = streams[VEL_X];
+	float* vy = streams[VEL_Y];
+	const float* bx = streams[BOUND_X];
+	const float* by = streams[BOUND_Y];
+	end = (end + LANES - 1) / LANES * LANES;
+	if (end > capacity) end = capacity;
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+	__m256 const step = _mm256_set1_ps(dt);
+	__m256 const sign = _mm256_set1_ps(-0.0f);
+	for (int i = begin; i < end; i += 8) {
+		__m256 x = _mm256_load_ps(px + i);
+		__m256 y = _mm256_load_ps(py + i);
+		__m256 dx = _mm256_load_ps(vx + i);
+		__m256 dy = _mm256_load_ps(vy + i);
+		_mm256_store_ps(qx + i, x);
+		_mm256_store_ps(qy + i, y);
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		x = _mm256_fmadd_ps(dx, step, x);
+		y = _mm256_fmadd_ps(dy, step, y);
+#	else
+		x = _mm256_add_ps(_mm256_mul_ps(dx, step), x);
+		y = _mm256_add_ps(_mm256_mul_ps(dy, step), y);
+#	endif
+
+		__m256 hitX = _mm256_cmp_ps(_mm256_andnot_ps(sign, x), _mm256_load_ps(bx + i), _CMP_GE_OQ);
+		__m256 hitY = _mm256_cmp_ps(_mm256_andnot_ps(sign, y), _mm256_load_ps(by + i), _CMP_GE_OQ);
+		_mm256_store_ps(px + i, x);
+		_mm256_store_ps(py + i, y);
+		_mm256_store_ps(vx + i, _mm256_xor_ps(dx, _mm256_and_ps(hitX, sign)));
+		_mm256_store_ps(vy + i, _mm256_xor_ps(dy, _mm256_and_ps(hitY, sign)));
+	}
+#elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+	glm_vec4 const step = _mm_set1_ps(dt);
+	glm_vec4 const sign = _mm_set1_ps(-0.0f);
+	for (int i = begin; i < end; i += 4) {
+		glm_vec4 x = _mm_load_ps(px + i);
+		glm_vec4 y = _mm_load_ps(py + i);
+		glm_vec4 dx = _mm_load_ps(vx + i);
+		glm_vec4 dy = _mm_load_ps(vy + i);
+		_mm_store_ps(qx + i, x);
+		_mm_store_ps(qy + i, y);
+
+		x = glm_vec4_fma(dx, step, x);
+		y = glm_vec4_fma(dy, step, y);
+
+		glm_vec4 hitX = _mm_cmpge_ps(glm_vec4_abs(x), _mm_load_ps(bx + i));
+		glm_vec4 hitY = _mm_cmpge_ps(glm_vec4_abs(y), _mm_load_ps(by + i));
+		_mm_store_ps(px + i, x);
+		_mm_store_ps(py + i, y);
+		_mm_store_ps(vx + i, _mm_xor_ps(dx, _mm_and_ps(hitX, sign)));
+		_mm_store_ps(vy + i, _mm_xor_ps(dy, _mm_and_ps(hitY, sign)));
+	}
+#else
+	for (int i = begin; i < end; i++) {
+		qx[i] = px[i];
+		qy[i] = py[i];
+		px[i] += vx[i] * dt;
+		py[i] += vy[i] * dt;
+		vx[i] = std::abs(px[i]) >= bx[i] ? -vx[i] : vx[i];
+		vy[i] = std::abs(py[i]) >= by[i] ? -vy[i] : vy[i];
+	}
+#endif
+}
+
+void EntityStore::updateScalar(float dt) {
+	for (int i = 0; i < count; i++) {
+		streams[PREV_X][i] = streams[POS_X][i];
+		streams[PREV_Y][i] = streams[POS_Y][i];
+		streams[POS_X][i] += streams[VEL_X][i] * dt;
+		streams[POS_Y][i] += streams[VEL_Y][i] * dt;
+
+		if (std::abs(streams[POS_X][i]) >= streams[BOUND_X][i])
+			streams[VEL_X][i] = -streams[VEL_X][i];
+		if (std::abs(streams[POS_Y][i]) >= streams[BOUND_Y][i])
+			streams[VEL_Y][i] = -streams[VEL_Y][i];
+	}
+}
+
+EntityView EntityStore::view() {
+	EntityView view = {
+		count,
+		streams[POS_X], streams[POS_Y],
+		streams[PREV_X], streams[PREV_Y],
+		streams[VEL_X], streams[VEL_Y]
+	};
+	return view;
+}
+
+int EntityStore::getCount() {
+	return count;
+}
+
+int EntityStore::getCapacity() {
+	return capacity;
+}
+
+void EntitySnapshots::init(int capacity) {
+	for (Buffer& buffer : buffers) {
+		buffer.x.assign(capacity, 0.0f);
+		buffer.y.assign(capacity, 0.0f);
+		buffer.prevX.assign(capacity, 0.0f);
+		buffer.prevY.assign(capacity, 0.0f);
+		buffer.velX.assign(capacity, 0.0f);
+		buffer.velY.assign(capacity, 0.0f);
+		buffer.count = 0;
+	}
+	front = 0;
+}
+
+void EntitySnapshots::capture(const EntityView& source, int begin, int end) {
+	Buffer& back = buffers[front ^ 1];
+	size_t size = (end - begin) * sizeof(float);
+
+	memcpy(&back.x[begin], source.x + begin, size);
+	memcpy(&back.y[begin], source.y + begin, size);
+	memcpy(&back.prevX[begin], source.prevX + begin, size);
+	memcpy(&back.prevY[begin], source.prevY + begin, size);
+	memcpy(&back.velX[begin], source.velX + begin, size);
+	memcpy(&back.velY[begin], source.velY + begin, size);
+}
+
+void EntitySnapshots::publish(int count, float alpha) {
+	Buffer& back = buffers[front ^ 1];
+	back.count = count;
+	back.alpha = alpha;
+	front ^= 1;
+}
+
+EntityView EntitySnapshots::getFront() {
+	Buffer& buffer = buffers[front];
+	EntityView view = {
+		buffer.count,
+		buffer.x.data(), buffer.y.data(),
+		buffer.prevX.data(), buffer.prevY.data(),
+		buffer.velX.data(), buffer.velY.data()
+	};
+	return view;
+}
+
+float EntitySnapshots::getFrontAlpha() {
+	return buffers[front].alpha;
+}
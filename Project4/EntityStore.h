@@ -0,0 +1,75 @@
+#pragma once
+
+#include <vector>
+
+// Read-only view of entity positions for rendering. prev* hold the
+// state before the last step, so the renderer can interpolate.
+struct EntityView {
+	int count;
+	const float* x;
+	const float* y;
+	const float* prevX;
+	const float* prevY;
+	const float* velX;
+	const float* velY;
+};
+
+// Structure-of-arrays store for the bouncing objects. Every stream is
+// its own aligned array padded to the widest SIMD width, so the update
+// kernel runs without a scalar tail.
+class EntityStore {
+public:
+	static const int ALIGNMENT = 64; // bytes
+	static const int LANES = ALIGNMENT / sizeof(float);
+
+private:
+	enum Stream { POS_X, POS_Y, PREV_X, PREV_Y, VEL_X, VEL_Y, BOUND_X, BOUND_Y, STREAM_COUNT };
+
+	std::vector<float> storage;
+	float* streams[STREAM_COUNT] = {};
+	int count = 0;
+	int capacity = 0; // rounded up to LANES
+
+public:
+	int init(int capacity);
+
+	// replaces the entities with count randomly placed ones
+	void spawn(int count, unsigned int seed);
+
+	// vectorized, branchless step of all entities
+	void update(float dt);
+	// same for [begin, end), begin must be a multiple of LANES
+	void update(int begin, int end, float dt);
+	// reference path with the original per-object branches
+	void updateScalar(float dt);
+
+	EntityView view();
+	int getCount();
+	int getCapacity();
+};
+
+// Double-buffered copy of the renderable streams. The simulation side
+// captures into the back buffer and publishes it, the render side only
+// reads the front one, so neither waits on the other mid-frame.
+class EntitySnapshots {
+private:
+	struct Buffer {
+		std::vector<float> x, y, prevX, prevY, velX, velY;
+		int count = 0;
+		float alpha = 0.0f;
+	};
+
+	Buffer buffers[2];
+	int front = 0;
+
+public:
+	void init(int capacity);
+
+	// copies [begin, end) of source into the back buffer
+	void capture(const EntityView& source, int begin, int end);
+	// swaps buffers; alpha is the interpolation factor for the new front
+	void publish(int count, float alpha);
+
+	EntityView getFront();
+	float getFrontAlpha();
+};
@@ -0,0 +1,139 @@
+#include "FileWatcher.h"
+
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+static std::string splitDirectory(const std::string& path, std::string& name) {
+	size_t slash = path.find_last_of("/\\");
+	if (slash == std::string::npos) {
+		name = path;
+		return ".";
+	}
+	name = path.substr(slash + 1);
+	return path.substr(0, slash);
+}
+
+static void addOnce(std::vector<std::string>& paths, const std::string& path) {
+	if (std::find(paths.begin(), paths.end(), path) == paths.end()) paths.push_back(path);
+}
+
+FileWatcher::~FileWatcher() {
+	destroy();
+}
+
+int FileWatcher::init() {
+#ifdef __linux__
+	inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (inotifyFd < 0) printf("inotify unavailable, polling shader files\n");
+#endif
+	return 0;
+}
+
+void FileWatcher::destroy() {
+#ifdef __linux__
+	if (inotifyFd >= 0) close(inotifyFd);
+#endif
+	inotifyFd = -1;
+	watchIds.clear();
+	watchDirs.clear();
+	files.clear();
+}
+
+// two saves within the same second must still differ, st_mtime alone
+// only has whole seconds
+FileWatcher::Stamp FileWatcher::stampOf(const std::string& path) {
+	Stamp stamp = { 0, 0 };
+#ifdef _WIN32
+	WIN32_FILE_ATTRIBUTE_DATA info;
+	if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &info)) return stamp;
+	// 100 ns ticks
+	stamp.mtime = (((long long)info.ftLastWriteTime.dwHighDateTime << 32) | info.ftLastWriteTime.dwLowDateTime) * 100;
+	stamp.size = ((long long)info.nFileSizeHigh << 32) | info.nFileSizeLow;
+#else
+	struct stat info;
+	if (stat(path.c_str(), &info) != 0) return stamp;
+#if defined(__APPLE__)
+	stamp.mtime = (long long)info.st_mtimespec.tv_sec * 1000000000 + info.st_mtimespec.tv_nsec;
+#elif defined(__linux__)
+	stamp.mtime = (long long)info.st_mtim.tv_sec * 1000000000 + info.st_mtim.tv_nsec;
+#else
+	stamp.mtime = (long long)info.st_mtime * 1000000000;
+#endif
+	stamp.size = (long long)info.st_size;
+#endif
+	return stamp;
+}
+
+void FileWatcher::watch(const std::string& path) {
+	for (File& file : files)
+		if (file.path == path) return;
+
+	File file = { path, stampOf(path) };
+	files.push_back(file);
+
+#ifdef __linux__
+	if (inotifyFd < 0) return;
+
+	std::string name;
+	std::string directory = splitDirectory(path, name);
+	if (std::find(watchDirs.begin(), watchDirs.end(), directory) != watchDirs.end()) return;
+
+	int id = inotify_add_watch(inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+	if (id < 0) {
+		printf("Can't watch '%s'\n", directory.c_str());
+		return;
+	}
+	watchIds.push_back(id);
+	watchDirs.push_back(directory);
+#endif
+}
+
+bool FileWatcher::poll(std::vector<std::string>& changed) {
+	size_t before = changed.size();
+
+#ifdef __linux__
+	if (inotifyFd >= 0) {
+		alignas(struct inotify_event) char buffer[4096];
+		ssize_t length;
+		while ((length = read(inotifyFd, buffer, sizeof(buffer))) > 0) {
+			for (char* at = buffer; at < buffer + length;) {
+				const struct inotify_event* event = (const struct inotify_event*)at;
+				at += sizeof(struct inotify_event) + event->len;
+				if (!event->len) continue;
+
+				size_t dir = std::find(watchIds.begin(), watchIds.end(), event->wd) - watchIds.begin();
+				if (dir == watchIds.size()) continue;
+
+				std::string path = watchDirs[dir] == "." ? std::string(event->name) : watchDirs[dir] + "/" + event->name;
+				for (File& file : files)
+					if (file.path == path) addOnce(changed, path);
+			}
+		}
+		return changed.size() > before;
+	}
+#endif
+
+	double now = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	if (now - lastScan < POLL_MS) return false;
+	lastScan = now;
+
+	for (File& file : files) {
+		Stamp stamp = stampOf(file.path);
+		if (stamp == file.stamp) continue;
+		file.stamp = stamp;
+		addOnce(changed, file.path);
+	}
+	return changed.size() > before;
+}
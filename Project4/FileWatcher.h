@@ -0,0 +1,45 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+// Reports files that were written since the last poll(). On Linux the
+// directories of the watched files are registered with inotify, which
+// also catches editors that save by renaming a temporary file; other
+// platforms compare modification time (sub-second where the platform
+// has it) and size, at most every POLL_MS.
+class FileWatcher {
+public:
+	static const int POLL_MS = 250;
+
+private:
+	struct Stamp {
+		long long mtime; // nanoseconds, 0 if the file is missing
+		long long size;
+
+		bool operator==(const Stamp& other) const { return mtime == other.mtime && size == other.size; }
+	};
+
+	struct File {
+		std::string path;
+		Stamp stamp;
+	};
+
+	std::vector<File> files;
+	int inotifyFd = -1;
+	std::vector<int> watchIds;          // inotify watch per directory
+	std::vector<std::string> watchDirs; // same order as watchIds
+	double lastScan = 0.0;
+
+	static Stamp stampOf(const std::string& path);
+
+public:
+	~FileWatcher();
+
+	int init();
+	void destroy();
+
+	void watch(const std::string& path);
+	// appends changed paths to changed (each once); returns true if any
+	bool poll(std::vector<std::string>& changed);
+};
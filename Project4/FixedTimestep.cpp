@@ -0,0 +1,29 @@
+#include "FixedTimestep.h"
+
+FixedTimestep::FixedTimestep(double hz, int maxSteps) :
+	step(1.0 / hz), accumulator(0.0), maxSteps(maxSteps)
+{ }
+
+// returns how many fixed steps have to run this frame
+int FixedTimestep::advance(float frameDelta) {
+	accumulator += frameDelta;
+
+	int steps = (int)(accumulator / step);
+	if (steps > maxSteps) {
+		// drop the time we can't catch up on instead of spiralling
+		steps = maxSteps;
+		accumulator = step * maxSteps;
+	}
+
+	accumulator -= steps * step;
+	return steps;
+}
+
+float FixedTimestep::getStep() {
+	return (float)step;
+}
+
+// how far the render time is between the last two simulation states
+float FixedTimestep::getAlpha() {
+	return (float)(accumulator / step);
+}
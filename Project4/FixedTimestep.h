@@ -0,0 +1,17 @@
+#pragma once
+
+// Accumulates variable frame time and hands it out in fixed simulation
+// steps, independent of the render rate.
+class FixedTimestep {
+private:
+	double step;        // simulation step in seconds
+	double accumulator; // time not yet simulated
+	int maxSteps;       // cap per frame so a stall can't snowball
+
+public:
+	FixedTimestep(double hz, int maxSteps = 8);
+
+	int advance(float frameDelta);
+	float getStep();
+	float getAlpha();
+};
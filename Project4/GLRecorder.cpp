@@ -0,0 +1,802 @@
+#define GLRECORDER_NO_REDIRECT
+#include "GLRecorder.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+void (GLAPIENTRY* glrecClear)(GLbitfield) = glClear;
+void (GLAPIENTRY* glrecClearColor)(GLfloat, GLfloat, GLfloat, GLfloat) = glClearColor;
+void (GLAPIENTRY* glrecDrawArrays)(GLenum, GLint, GLsizei) = glDrawArrays;
+void (GLAPIENTRY* glrecViewport)(GLint, GLint, GLsizei, GLsizei) = glViewport;
+void (GLAPIENTRY* glrecFlush)(void) = glFlush;
+void (GLAPIENTRY* glrecFinish)(void) = glFinish;
+void (GLAPIENTRY* glrecPixelStorei)(GLenum, GLint) = glPixelStorei;
+void (GLAPIENTRY* glrecReadPixels)(GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, void*) = glReadPixels;
+
+// header, then per frame: u32 byte size, u32 call count, the calls;
+// a call is a u8 opcode followed by its arguments in call order
+static const unsigned int LOG_MAGIC = 0x43524c47; // "GLRC"
+static const unsigned int LOG_VERSION = 1;
+
+enum Op {
+	OP_GEN_BUFFERS, OP_DELETE_BUFFERS, OP_BIND_BUFFER, OP_BUFFER_DATA, OP_WRITE_MAPPED,
+	OP_GEN_VERTEX_ARRAYS, OP_DELETE_VERTEX_ARRAYS, OP_BIND_VERTEX_ARRAY,
+	OP_VERTEX_ATTRIB_POINTER, OP_ENABLE_VERTEX_ATTRIB_ARRAY, OP_VERTEX_ATTRIB_DIVISOR,
+	OP_CREATE_PROGRAM, OP_DELETE_PROGRAM, OP_CREATE_SHADER, OP_DELETE_SHADER, OP_SHADER_SOURCE,
+	OP_COMPILE_SHADER, OP_ATTACH_SHADER, OP_DETACH_SHADER, OP_LINK_PROGRAM, OP_PROGRAM_PARAMETERI,
+	OP_VALIDATE_PROGRAM, OP_USE_PROGRAM, OP_PROGRAM_BINARY,
+	OP_UNIFORM_1I, OP_UNIFORM_1F, OP_UNIFORM_2F, OP_UNIFORM_4F,
+	OP_DRAW_ARRAYS, OP_DRAW_ARRAYS_INSTANCED, OP_CLEAR, OP_CLEAR_COLOR, OP_VIEWPORT,
+	OP_FLUSH, OP_FINISH, OP_PIXEL_STOREI, OP_READ_PIXELS,
+	OP_GEN_FRAMEBUFFERS, OP_DELETE_FRAMEBUFFERS, OP_BIND_FRAMEBUFFER,
+	OP_GEN_RENDERBUFFERS, OP_DELETE_RENDERBUFFERS, OP_BIND_RENDERBUFFER,
+	OP_RENDERBUFFER_STORAGE, OP_FRAMEBUFFER_RENDERBUFFER,
+	OP_FENCE_SYNC, OP_CLIENT_WAIT_SYNC, OP_DELETE_SYNC,
+	OP_BUFFER_SUB_DATA, OP_COPY_BUFFER_SUB_DATA,
+	OP_COUNT
+};
+
+// object kinds with their own name space
+enum Kind { KIND_BUFFER, KIND_VERTEX_ARRAY, KIND_PROGRAM, KIND_SHADER, KIND_FRAMEBUFFER, KIND_RENDERBUFFER, KIND_COUNT };
+
+// ---------------------------------------------------------------- recording
+
+// buffer range mapped by the app, copied into the log on unmap
+struct Mapping {
+	GLintptr offset;
+	GLsizeiptr length;
+	GLbitfield access;
+	void* pointer;
+};
+
+static FILE* logFile = nullptr;
+static std::vector<char> frameData;
+static unsigned int frameCalls = 0;
+static long recordedFrames = 0;
+static long long recordedCalls = 0;
+static long long recordedBytes = 0;
+static std::unordered_map<GLenum, Mapping> mappings;
+
+static void put(const void* data, size_t size) {
+	frameData.insert(frameData.end(), (const char*)data, (const char*)data + size);
+}
+
+static void put32(unsigned int value) { put(&value, 4); }
+static void put64(unsigned long long value) { put(&value, 8); }
+static void putf(float value) { put(&value, 4); }
+
+static void putBlob(const void* data, size_t size) {
+	put64(data ? size : 0);
+	if (data) put(data, size);
+}
+
+static void begin(Op op) {
+	unsigned char code = (unsigned char)op;
+	put(&code, 1);
+	frameCalls++;
+}
+
+static void putNames(GLsizei n, const GLuint* names) {
+	put32(n);
+	put(names, n * sizeof(GLuint));
+}
+
+// GLEW entry points that are swapped while recording
+#define GLEW_HOOKS(X) \
+	X(GenBuffers) X(DeleteBuffers) X(BindBuffer) X(BufferData) X(MapBufferRange) X(UnmapBuffer) \
+	X(GenVertexArrays) X(DeleteVertexArrays) X(BindVertexArray) \
+	X(VertexAttribPointer) X(EnableVertexAttribArray) X(VertexAttribDivisor) \
+	X(CreateProgram) X(DeleteProgram) X(CreateShader) X(DeleteShader) X(ShaderSource) \
+	X(CompileShader) X(AttachShader) X(DetachShader) X(LinkProgram) X(ProgramParameteri) \
+	X(ValidateProgram) X(UseProgram) X(ProgramBinary) \
+	X(Uniform1i) X(Uniform1f) X(Uniform2f) X(Uniform4f) X(DrawArraysInstanced) \
+	X(GenFramebuffers) X(DeleteFramebuffers) X(BindFramebuffer) \
+	X(GenRenderbuffers) X(DeleteRenderbuffers) X(BindRenderbuffer) \
+	X(RenderbufferStorage) X(FramebufferRenderbuffer) \
+	X(FenceSync) X(ClientWaitSync) X(DeleteSync) X(BufferSubData) X(CopyBufferSubData)
+
+#define CORE_HOOKS(X) \
+	X(Clear) X(ClearColor) X(DrawArrays) X(Viewport) X(Flush) X(Finish) X(PixelStorei) X(ReadPixels)
+
+#define DECLARE_GLEW(name) static decltype(__glew##name) real##name;
+#define DECLARE_CORE(name) static decltype(glrec##name) real##name;
+GLEW_HOOKS(DECLARE_GLEW)
+CORE_HOOKS(DECLARE_CORE)
+
+static void GLAPIENTRY hookGenBuffers(GLsizei n, GLuint* buffers) {
+	realGenBuffers(n, buffers);
+	begin(OP_GEN_BUFFERS); putNames(n, buffers);
+}
+
+static void GLAPIENTRY hookDeleteBuffers(GLsizei n, const GLuint* buffers) {
+	begin(OP_DELETE_BUFFERS); putNames(n, buffers);
+	realDeleteBuffers(n, buffers);
+}
+
+static void GLAPIENTRY hookBindBuffer(GLenum target, GLuint buffer) {
+	begin(OP_BIND_BUFFER); put32(target); put32(buffer);
+	realBindBuffer(target, buffer);
+}
+
+static void GLAPIENTRY hookBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) {
+	begin(OP_BUFFER_DATA); put32(target); put64(size); putBlob(data, size); put32(usage);
+	realBufferData(target, size, data, usage);
+}
+
+static void GLAPIENTRY hookBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) {
+	begin(OP_BUFFER_SUB_DATA); put32(target); put64(offset); putBlob(data, size);
+	realBufferSubData(target, offset, size, data);
+}
+
+static void GLAPIENTRY hookCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	begin(OP_COPY_BUFFER_SUB_DATA); put32(readTarget); put32(writeTarget); put64(readOffset); put64(writeOffset); put64(size);
+	realCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+
+static void* GLAPIENTRY hookMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	void* pointer = realMapBufferRange(target, offset, length, access);
+	if (access & GL_MAP_PERSISTENT_BIT) printf("GL recorder: persistent mappings are not captured\n");
+
+	Mapping mapping = { offset, length, access, pointer };
+	mappings[target] = mapping;
+	return pointer;
+}
+
+static GLboolean GLAPIENTRY hookUnmapBuffer(GLenum target) {
+	auto found = mappings.find(target);
+	if (found != mappings.end()) {
+		const Mapping& mapping = found->second;
+		if ((mapping.access & GL_MAP_WRITE_BIT) && mapping.pointer) {
+			begin(OP_WRITE_MAPPED); put32(target); put64(mapping.offset); put32(mapping.access);
+			putBlob(mapping.pointer, mapping.length);
+		}
+		mappings.erase(found);
+	}
+	return realUnmapBuffer(target);
+}
+
+static void GLAPIENTRY hookGenVertexArrays(GLsizei n, GLuint* arrays) {
+	realGenVertexArrays(n, arrays);
+	begin(OP_GEN_VERTEX_ARRAYS); putNames(n, arrays);
+}
+
+static void GLAPIENTRY hookDeleteVertexArrays(GLsizei n, const GLuint* arrays) {
+	begin(OP_DELETE_VERTEX_ARRAYS); putNames(n, arrays);
+	realDeleteVertexArrays(n, arrays);
+}
+
+static void GLAPIENTRY hookBindVertexArray(GLuint array) {
+	begin(OP_BIND_VERTEX_ARRAY); put32(array);
+	realBindVertexArray(array);
+}
+
+static void GLAPIENTRY hookVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer) {
+	begin(OP_VERTEX_ATTRIB_POINTER); put32(index); put32(size); put32(type); put32(normalized); put32(stride); put64((size_t)pointer);
+	realVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+static void GLAPIENTRY hookEnableVertexAttribArray(GLuint index) {
+	begin(OP_ENABLE_VERTEX_ATTRIB_ARRAY); put32(index);
+	realEnableVertexAttribArray(index);
+}
+
+static void GLAPIENTRY hookVertexAttribDivisor(GLuint index, GLuint divisor) {
+	begin(OP_VERTEX_ATTRIB_DIVISOR); put32(index); put32(divisor);
+	realVertexAttribDivisor(index, divisor);
+}
+
+static GLuint GLAPIENTRY hookCreateProgram() {
+	GLuint program = realCreateProgram();
+	begin(OP_CREATE_PROGRAM); put32(program);
+	return program;
+}
+
+static void GLAPIENTRY hookDeleteProgram(GLuint program) {
+	begin(OP_DELETE_PROGRAM); put32(program);
+	realDeleteProgram(program);
+}
+
+static GLuint GLAPIENTRY hookCreateShader(GLenum type) {
+	GLuint shader = realCreateShader(type);
+	begin(OP_CREATE_SHADER); put32(type); put32(shader);
+	return shader;
+}
+
+static void GLAPIENTRY hookDeleteShader(GLuint shader) {
+	begin(OP_DELETE_SHADER); put32(shader);
+	realDeleteShader(shader);
+}
+
+static void GLAPIENTRY hookShaderSource(GLuint shader, GLsizei count, const GLchar* const* strings, const GLint* lengths) {
+	begin(OP_SHADER_SOURCE); put32(shader); put32(count);
+	for (GLsizei i = 0; i < count; i++)
+		putBlob(strings[i], lengths && lengths[i] >= 0 ? lengths[i] : strlen(strings[i]));
+	realShaderSource(shader, count, strings, lengths);
+}
+
+static void GLAPIENTRY hookCompileShader(GLuint shader) {
+	begin(OP_COMPILE_SHADER); put32(shader);
+	realCompileShader(shader);
+}
+
+static void GLAPIENTRY hookAttachShader(GLuint program, GLuint shader) {
+	begin(OP_ATTACH_SHADER); put32(program); put32(shader);
+	realAttachShader(program, shader);
+}
+
+static void GLAPIENTRY hookDetachShader(GLuint program, GLuint shader) {
+	begin(OP_DETACH_SHADER); put32(program); put32(shader);
+	realDetachShader(program, shader);
+}
+
+static void GLAPIENTRY hookLinkProgram(GLuint program) {
+	begin(OP_LINK_PROGRAM); put32(program);
+	realLinkProgram(program);
+}
+
+static void GLAPIENTRY hookProgramParameteri(GLuint program, GLenum pname, GLint value) {
+	begin(OP_PROGRAM_PARAMETERI); put32(program); put32(pname); put32(value);
+	realProgramParameteri(program, pname, value);
+}
+
+static void GLAPIENTRY hookValidateProgram(GLuint program) {
+	begin(OP_VALIDATE_PROGRAM); put32(program);
+	realValidateProgram(program);
+}
+
+static void GLAPIENTRY hookUseProgram(GLuint program) {
+	begin(OP_USE_PROGRAM); put32(program);
+	realUseProgram(program);
+}
+
+static void GLAPIENTRY hookProgramBinary(GLuint program, GLenum format, const void* binary, GLsizei length) {
+	begin(OP_PROGRAM_BINARY); put32(program); put32(format); putBlob(binary, length);
+	realProgramBinary(program, format, binary, length);
+}
+
+static void GLAPIENTRY hookUniform1i(GLint location, GLint v0) {
+	begin(OP_UNIFORM_1I); put32(location); put32(v0);
+	realUniform1i(location, v0);
+}
+
+static void GLAPIENTRY hookUniform1f(GLint location, GLfloat v0) {
+	begin(OP_UNIFORM_1F); put32(location); putf(v0);
+	realUniform1f(location, v0);
+}
+
+static void GLAPIENTRY hookUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	begin(OP_UNIFORM_2F); put32(location); putf(v0); putf(v1);
+	realUniform2f(location, v0, v1);
+}
+
+static void GLAPIENTRY hookUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	begin(OP_UNIFORM_4F); put32(location); putf(v0); putf(v1); putf(v2); putf(v3);
+	realUniform4f(location, v0, v1, v2, v3);
+}
+
+static void GLAPIENTRY hookDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei primcount) {
+	begin(OP_DRAW_ARRAYS_INSTANCED); put32(mode); put32(first); put32(count); put32(primcount);
+	realDrawArraysInstanced(mode, first, count, primcount);
+}
+
+static void GLAPIENTRY hookGenFramebuffers(GLsizei n, GLuint* framebuffers) {
+	realGenFramebuffers(n, framebuffers);
+	begin(OP_GEN_FRAMEBUFFERS); putNames(n, framebuffers);
+}
+
+static void GLAPIENTRY hookDeleteFramebuffers(GLsizei n, const GLuint* framebuffers) {
+	begin(OP_DELETE_FRAMEBUFFERS); putNames(n, framebuffers);
+	realDeleteFramebuffers(n, framebuffers);
+}
+
+static void GLAPIENTRY hookBindFramebuffer(GLenum target, GLuint framebuffer) {
+	begin(OP_BIND_FRAMEBUFFER); put32(target); put32(framebuffer);
+	realBindFramebuffer(target, framebuffer);
+}
+
+static void GLAPIENTRY hookGenRenderbuffers(GLsizei n, GLuint* renderbuffers) {
+	realGenRenderbuffers(n, renderbuffers);
+	begin(OP_GEN_RENDERBUFFERS); putNames(n, renderbuffers);
+}
+
+static void GLAPIENTRY hookDeleteRenderbuffers(GLsizei n, const GLuint* renderbuffers) {
+	begin(OP_DELETE_RENDERBUFFERS); putNames(n, renderbuffers);
+	realDeleteRenderbuffers(n, renderbuffers);
+}
+
+static void GLAPIENTRY hookBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	begin(OP_BIND_RENDERBUFFER); put32(target); put32(renderbuffer);
+	realBindRenderbuffer(target, renderbuffer);
+}
+
+static void GLAPIENTRY hookRenderbufferStorage(GLenum target, GLenum format, GLsizei width, GLsizei height) {
+	begin(OP_RENDERBUFFER_STORAGE); put32(target); put32(format); put32(width); put32(height);
+	realRenderbufferStorage(target, format, width, height);
+}
+
+static void GLAPIENTRY hookFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbufferTarget, GLuint renderbuffer) {
+	begin(OP_FRAMEBUFFER_RENDERBUFFER); put32(target); put32(attachment); put32(renderbufferTarget); put32(renderbuffer);
+	realFramebufferRenderbuffer(target, attachment, renderbufferTarget, renderbuffer);
+}
+
+static GLsync GLAPIENTRY hookFenceSync(GLenum condition, GLbitfield flags) {
+	GLsync sync = realFenceSync(condition, flags);
+	begin(OP_FENCE_SYNC); put32(condition); put32(flags); put64((unsigned long long)(size_t)sync);
+	return sync;
+}
+
+static GLenum GLAPIENTRY hookClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	begin(OP_CLIENT_WAIT_SYNC); put64((unsigned long long)(size_t)sync); put32(flags); put64(timeout);
+	return realClientWaitSync(sync, flags, timeout);
+}
+
+static void GLAPIENTRY hookDeleteSync(GLsync sync) {
+	begin(OP_DELETE_SYNC); put64((unsigned long long)(size_t)sync);
+	realDeleteSync(sync);
+}
+
+static void GLAPIENTRY hookClear(GLbitfield mask) {
+	begin(OP_CLEAR); put32(mask);
+	realClear(mask);
+}
+
+static void GLAPIENTRY hookClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	begin(OP_CLEAR_COLOR); putf(red); putf(green); putf(blue); putf(alpha);
+	realClearColor(red, green, blue, alpha);
+}
+
+static void GLAPIENTRY hookDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	begin(OP_DRAW_ARRAYS); put32(mode); put32(first); put32(count);
+	realDrawArrays(mode, first, count);
+}
+
+static void GLAPIENTRY hookViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	begin(OP_VIEWPORT); put32(x); put32(y); put32(width); put32(height);
+	realViewport(x, y, width, height);
+}
+
+static void GLAPIENTRY hookFlush() {
+	begin(OP_FLUSH);
+	realFlush();
+}
+
+static void GLAPIENTRY hookFinish() {
+	begin(OP_FINISH);
+	realFinish();
+}
+
+static void GLAPIENTRY hookPixelStorei(GLenum pname, GLint param) {
+	begin(OP_PIXEL_STOREI); put32(pname); put32(param);
+	realPixelStorei(pname, param);
+}
+
+static void GLAPIENTRY hookReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels) {
+	begin(OP_READ_PIXELS); put32(x); put32(y); put32(width); put32(height); put32(format); put32(type);
+	realReadPixels(x, y, width, height, format, type, pixels);
+}
+
+int GLRecorder::start(const std::string& path) {
+	if (logFile) return 0;
+
+	logFile = fopen(path.c_str(), "wb");
+	if (!logFile) {
+		printf("Can't open GL log '%s'!\n", path.c_str());
+		return 1;
+	}
+	unsigned int header[2] = { LOG_MAGIC, LOG_VERSION };
+	fwrite(header, sizeof(header), 1, logFile);
+
+	frameData.clear();
+	frameCalls = 0;
+	recordedFrames = 0;
+	recordedCalls = 0;
+	recordedBytes = sizeof(header);
+
+#define INSTALL_GLEW(name) real##name = __glew##name; __glew##name = hook##name;
+#define INSTALL_CORE(name) real##name = glrec##name; glrec##name = hook##name;
+	GLEW_HOOKS(INSTALL_GLEW)
+	CORE_HOOKS(INSTALL_CORE)
+	return 0;
+}
+
+void GLRecorder::stop() {
+	if (!logFile) return;
+
+#define RESTORE_GLEW(name) __glew##name = real##name;
+#define RESTORE_CORE(name) glrec##name = real##name;
+	GLEW_HOOKS(RESTORE_GLEW)
+	CORE_HOOKS(RESTORE_CORE)
+
+	if (frameCalls) endFrame();
+	fclose(logFile);
+	logFile = nullptr;
+	mappings.clear();
+
+	printf("GL log: %ld frames, %lld calls (%.1f per frame), %.1f KB\n",
+		recordedFrames, recordedCalls, recordedFrames ? (double)recordedCalls / recordedFrames : 0.0, recordedBytes / 1024.0);
+}
+
+bool GLRecorder::isRecording() {
+	return logFile != nullptr;
+}
+
+void GLRecorder::endFrame() {
+	if (!logFile) return;
+
+	unsigned int block[2] = { (unsigned int)frameData.size(), frameCalls };
+	fwrite(block, sizeof(block), 1, logFile);
+	fwrite(frameData.data(), 1, frameData.size(), logFile);
+
+	recordedFrames++;
+	recordedCalls += frameCalls;
+	recordedBytes += sizeof(block) + frameData.size();
+	frameData.clear();
+	frameCalls = 0;
+}
+
+// ---------------------------------------------------------------- replay
+
+struct LogFrame {
+	size_t offset;
+	size_t size;
+	unsigned int calls;
+};
+
+class Replayer {
+private:
+	const char* at = nullptr;
+	const char* end = nullptr;
+	bool overrun = false; // a read ran past the end of the frame
+	std::unordered_map<GLuint, GLuint> names[KIND_COUNT];
+	std::unordered_map<unsigned long long, GLsync> syncs;
+	std::vector<GLuint> scratchNames;
+	std::vector<char> scratchPixels;
+	GLuint defaultFramebuffer = 0;
+
+	// the log is not trusted: reads past the frame read as zero and mark
+	// the frame as overrun, run() stops after the call that did it
+	bool fits(size_t count, size_t each) {
+		if (!overrun && count <= (size_t)(end - at) / each) return true;
+		overrun = true;
+		return false;
+	}
+
+	unsigned int get32() { unsigned int value = 0; if (fits(1, 4)) { memcpy(&value, at, 4); at += 4; } return value; }
+	unsigned long long get64() { unsigned long long value = 0; if (fits(1, 8)) { memcpy(&value, at, 8); at += 8; } return value; }
+	float getf() { float value = 0.0f; if (fits(1, 4)) { memcpy(&value, at, 4); at += 4; } return value; }
+
+	const void* getBlob(size_t& size) {
+		size = (size_t)get64();
+		if (!fits(size, 1)) size = 0;
+		const void* data = size ? at : nullptr;
+		at += size;
+		return data;
+	}
+
+	GLuint name(Kind kind, GLuint recorded) {
+		if (!recorded) return kind == KIND_FRAMEBUFFER ? defaultFramebuffer : 0;
+		auto found = names[kind].find(recorded);
+		return found == names[kind].end() ? 0 : found->second;
+	}
+
+	// Gen*: create as many new names and remember the translation
+	template <typename GenFunc>
+	void gen(Kind kind, GenFunc genFunc) {
+		GLsizei n = (GLsizei)get32();
+		if (!fits(n, 4)) return;
+		scratchNames.resize(n);
+		genFunc(n, scratchNames.data());
+		for (GLsizei i = 0; i < n; i++)
+			names[kind][get32()] = scratchNames[i];
+	}
+
+	// Delete*: translate, then forget the names
+	template <typename DeleteFunc>
+	void remove(Kind kind, DeleteFunc deleteFunc) {
+		GLsizei n = (GLsizei)get32();
+		if (!fits(n, 4)) return;
+		scratchNames.resize(n);
+		for (GLsizei i = 0; i < n; i++) {
+			GLuint recorded = get32();
+			scratchNames[i] = name(kind, recorded);
+			names[kind].erase(recorded);
+		}
+		deleteFunc(n, scratchNames.data());
+	}
+
+public:
+	Replayer(GLuint defaultFramebuffer) : defaultFramebuffer(defaultFramebuffer) { }
+
+	bool run(const char* data, const char* end, unsigned int calls);
+};
+
+bool Replayer::run(const char* data, const char* end, unsigned int calls) {
+	at = data;
+	this->end = end;
+	overrun = false;
+	for (unsigned int call = 0; call < calls; call++) {
+		if (!fits(1, 1)) {
+			printf("GL log: frame ends before call %u of %u\n", call + 1, calls);
+			return false;
+		}
+		unsigned char op = (unsigned char)*at++;
+		switch (op) {
+		case OP_GEN_BUFFERS: gen(KIND_BUFFER, glGenBuffers); break;
+		case OP_DELETE_BUFFERS: remove(KIND_BUFFER, glDeleteBuffers); break;
+		case OP_BIND_BUFFER: { GLenum target = get32(); glBindBuffer(target, name(KIND_BUFFER, get32())); break; }
+		case OP_BUFFER_DATA: {
+			GLenum target = get32();
+			GLsizeiptr size = (GLsizeiptr)get64();
+			size_t blobSize;
+			const void* blob = getBlob(blobSize);
+			glBufferData(target, size, blob, get32());
+			break;
+		}
+		case OP_BUFFER_SUB_DATA: {
+			GLenum target = get32();
+			GLintptr offset = (GLintptr)get64();
+			size_t size;
+			const void* blob = getBlob(size);
+			glBufferSubData(target, offset, size, blob);
+			break;
+		}
+		case OP_COPY_BUFFER_SUB_DATA: {
+			GLenum readTarget = get32();
+			GLenum writeTarget = get32();
+			GLintptr readOffset = (GLintptr)get64();
+			GLintptr writeOffset = (GLintptr)get64();
+			glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, (GLsizeiptr)get64());
+			break;
+		}
+		case OP_WRITE_MAPPED: {
+			GLenum target = get32();
+			GLintptr offset = (GLintptr)get64();
+			GLbitfield access = get32();
+			size_t size;
+			const void* blob = getBlob(size);
+			void* pointer = glMapBufferRange(target, offset, size, access);
+			if (pointer) memcpy(pointer, blob, size);
+			glUnmapBuffer(target);
+			break;
+		}
+		case OP_GEN_VERTEX_ARRAYS: gen(KIND_VERTEX_ARRAY, glGenVertexArrays); break;
+		case OP_DELETE_VERTEX_ARRAYS: remove(KIND_VERTEX_ARRAY, glDeleteVertexArrays); break;
+		case OP_BIND_VERTEX_ARRAY: glBindVertexArray(name(KIND_VERTEX_ARRAY, get32())); break;
+		case OP_VERTEX_ATTRIB_POINTER: {
+			GLuint index = get32();
+			GLint size = get32();
+			GLenum type = get32();
+			GLboolean normalized = (GLboolean)get32();
+			GLsizei stride = get32();
+			glVertexAttribPointer(index, size, type, normalized, stride, (const void*)(size_t)get64());
+			break;
+		}
+		case OP_ENABLE_VERTEX_ATTRIB_ARRAY: glEnableVertexAttribArray(get32()); break;
+		case OP_VERTEX_ATTRIB_DIVISOR: { GLuint index = get32(); glVertexAttribDivisor(index, get32()); break; }
+		case OP_CREATE_PROGRAM: names[KIND_PROGRAM][get32()] = glCreateProgram(); break;
+		case OP_DELETE_PROGRAM: { GLuint recorded = get32(); glDeleteProgram(name(KIND_PROGRAM, recorded)); names[KIND_PROGRAM].erase(recorded); break; }
+		case OP_CREATE_SHADER: { GLenum type = get32(); names[KIND_SHADER][get32()] = glCreateShader(type); break; }
+		case OP_DELETE_SHADER: { GLuint recorded = get32(); glDeleteShader(name(KIND_SHADER, recorded)); names[KIND_SHADER].erase(recorded); break; }
+		case OP_SHADER_SOURCE: {
+			GLuint shader = name(KIND_SHADER, get32());
+			GLsizei count = get32();
+			// every string has at least its size in front
+			if (!fits(count, 8)) break;
+			std::vector<const GLchar*> strings(count);
+			std::vector<GLint> lengths(count);
+			for (GLsizei i = 0; i < count; i++) {
+				size_t size;
+				strings[i] = (const GLchar*)getBlob(size);
+				lengths[i] = (GLint)size;
+			}
+			glShaderSource(shader, count, strings.data(), lengths.data());
+			break;
+		}
+		case OP_COMPILE_SHADER: glCompileShader(name(KIND_SHADER, get32())); break;
+		case OP_ATTACH_SHADER: { GLuint program = name(KIND_PROGRAM, get32()); glAttachShader(program, name(KIND_SHADER, get32())); break; }
+		case OP_DETACH_SHADER: { GLuint program = name(KIND_PROGRAM, get32()); glDetachShader(program, name(KIND_SHADER, get32())); break; }
+		case OP_LINK_PROGRAM: glLinkProgram(name(KIND_PROGRAM, get32())); break;
+		case OP_PROGRAM_PARAMETERI: {
+			GLuint program = name(KIND_PROGRAM, get32());
+			GLenum pname = get32();
+			glProgramParameteri(program, pname, (GLint)get32());
+			break;
+		}
+		case OP_VALIDATE_PROGRAM: glValidateProgram(name(KIND_PROGRAM, get32())); break;
+		case OP_USE_PROGRAM: glUseProgram(name(KIND_PROGRAM, get32())); break;
+		case OP_PROGRAM_BINARY: {
+			GLuint program = name(KIND_PROGRAM, get32());
+			GLenum format = get32();
+			size_t size;
+			const void* blob = getBlob(size);
+			glProgramBinary(program, format, blob, (GLsizei)size);
+			break;
+		}
+		case OP_UNIFORM_1I: { GLint location = get32(); glUniform1i(location, (GLint)get32()); break; }
+		case OP_UNIFORM_1F: { GLint location = get32(); glUniform1f(location, getf()); break; }
+		case OP_UNIFORM_2F: {
+			GLint location = get32();
+			float x = getf(), y = getf();
+			glUniform2f(location, x, y);
+			break;
+		}
+		case OP_UNIFORM_4F: {
+			GLint location = get32();
+			float x = getf(), y = getf(), z = getf(), w = getf();
+			glUniform4f(location, x, y, z, w);
+			break;
+		}
+		case OP_DRAW_ARRAYS: {
+			GLenum mode = get32();
+			GLint first = get32();
+			glDrawArrays(mode, first, (GLsizei)get32());
+			break;
+		}
+		case OP_DRAW_ARRAYS_INSTANCED: {
+			GLenum mode = get32();
+			GLint first = get32();
+			GLsizei count = get32();
+			glDrawArraysInstanced(mode, first, count, (GLsizei)get32());
+			break;
+		}
+		case OP_CLEAR: glClear(get32()); break;
+		case OP_CLEAR_COLOR: {
+			float r = getf(), g = getf(), b = getf(), a = getf();
+			glClearColor(r, g, b, a);
+			break;
+		}
+		case OP_VIEWPORT: {
+			GLint x = get32(), y = get32();
+			GLsizei width = get32(), height = get32();
+			glViewport(x, y, width, height);
+			break;
+		}
+		case OP_FLUSH: glFlush(); break;
+		case OP_FINISH: glFinish(); break;
+		case OP_PIXEL_STOREI: { GLenum pname = get32(); glPixelStorei(pname, (GLint)get32()); break; }
+		case OP_READ_PIXELS: {
+			GLint x = get32(), y = get32();
+			GLsizei width = get32(), height = get32();
+			GLenum format = get32(), type = get32();
+			// large enough for 4 channels of 32 bits
+			scratchPixels.resize((size_t)width * height * 16);
+			glReadPixels(x, y, width, height, format, type, scratchPixels.data());
+			break;
+		}
+		case OP_GEN_FRAMEBUFFERS: gen(KIND_FRAMEBUFFER, glGenFramebuffers); break;
+		case OP_DELETE_FRAMEBUFFERS: remove(KIND_FRAMEBUFFER, glDeleteFramebuffers); break;
+		case OP_BIND_FRAMEBUFFER: { GLenum target = get32(); glBindFramebuffer(target, name(KIND_FRAMEBUFFER, get32())); break; }
+		case OP_GEN_RENDERBUFFERS: gen(KIND_RENDERBUFFER, glGenRenderbuffers); break;
+		case OP_DELETE_RENDERBUFFERS: remove(KIND_RENDERBUFFER, glDeleteRenderbuffers); break;
+		case OP_BIND_RENDERBUFFER: { GLenum target = get32(); glBindRenderbuffer(target, name(KIND_RENDERBUFFER, get32())); break; }
+		case OP_RENDERBUFFER_STORAGE: {
+			GLenum target = get32(), format = get32();
+			GLsizei width = get32(), height = get32();
+			glRenderbufferStorage(target, format, width, height);
+			break;
+		}
+		case OP_FRAMEBUFFER_RENDERBUFFER: {
+			GLenum target = get32(), attachment = get32(), renderbufferTarget = get32();
+			glFramebufferRenderbuffer(target, attachment, renderbufferTarget, name(KIND_RENDERBUFFER, get32()));
+			break;
+		}
+		case OP_FENCE_SYNC: {
+			GLenum condition = get32();
+			GLbitfield flags = get32();
+			syncs[get64()] = glFenceSync(condition, flags);
+			break;
+		}
+		case OP_CLIENT_WAIT_SYNC: {
+			GLsync sync = syncs[get64()];
+			GLbitfield flags = get32();
+			GLuint64 timeout = get64();
+			if (sync) glClientWaitSync(sync, flags, timeout);
+			break;
+		}
+		case OP_DELETE_SYNC: {
+			unsigned long long recorded = get64();
+			GLsync sync = syncs[recorded];
+			syncs.erase(recorded);
+			if (sync) glDeleteSync(sync);
+			break;
+		}
+		default:
+			printf("GL log: unknown call %d\n", op);
+			return false;
+		}
+
+		if (overrun) {
+			printf("GL log: call %u of %u (op %d) reads past the end of its frame\n", call + 1, calls, op);
+			return false;
+		}
+	}
+	return true;
+}
+
+static double nowMs() {
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int GLRecorder::replay(const std::string& path, GLuint defaultFramebuffer, int loops, ReplayStats& stats) {
+	memset(&stats, 0, sizeof(stats));
+
+	FILE* file = fopen(path.c_str(), "rb");
+	if (!file) {
+		printf("Can't open GL log '%s'!\n", path.c_str());
+		return 1;
+	}
+	std::vector<char> data;
+	char chunk[65536];
+	size_t read;
+	while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0)
+		data.insert(data.end(), chunk, chunk + read);
+	fclose(file);
+
+	unsigned int header[2] = { 0, 0 };
+	if (data.size() >= sizeof(header)) memcpy(header, data.data(), sizeof(header));
+	if (header[0] != LOG_MAGIC || header[1] != LOG_VERSION) {
+		printf("'%s' is not a GL log\n", path.c_str());
+		return 1;
+	}
+
+	// index the frame blocks
+	std::vector<LogFrame> frames;
+	size_t offset = sizeof(header);
+	while (offset + 8 <= data.size()) {
+		unsigned int block[2];
+		memcpy(block, data.data() + offset, sizeof(block));
+		LogFrame frame = { offset + sizeof(block), block[0], block[1] };
+		if (frame.offset + frame.size > data.size()) break;
+		frames.push_back(frame);
+		offset = frame.offset + frame.size;
+	}
+	if (frames.empty()) {
+		printf("GL log '%s' has no frames\n", path.c_str());
+		return 1;
+	}
+
+	Replayer replayer(defaultFramebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, defaultFramebuffer);
+
+	// the first frame creates everything and is not timed
+	const char* first = data.data() + frames[0].offset;
+	if (!replayer.run(first, first + frames[0].size, frames[0].calls)) return 1;
+	glFinish();
+
+	std::vector<double> submitMs;
+	double finishMs = 0.0;
+	long long calls = 0;
+	if (loops < 1) loops = 1;
+	for (int loop = 0; loop < loops; loop++) {
+		for (size_t i = 1; i < frames.size(); i++) {
+			double start = nowMs();
+			const char* frame = data.data() + frames[i].offset;
+			if (!replayer.run(frame, frame + frames[i].size, frames[i].calls)) return 1;
+			double submitted = nowMs();
+			glFinish();
+
+			submitMs.push_back(submitted - start);
+			finishMs += nowMs() - submitted;
+			calls += frames[i].calls;
+		}
+	}
+	if (submitMs.empty()) return 0;
+
+	double total = 0.0;
+	for (double ms : submitMs) total += ms;
+
+	stats.frames = (int)submitMs.size();
+	stats.callsPerFrame = (double)calls / stats.frames;
+	stats.submitMeanMs = total / stats.frames;
+	stats.finishMeanMs = finishMs / stats.frames;
+	stats.nsPerCall = calls ? total * 1e6 / calls : 0.0;
+
+	std::sort(submitMs.begin(), submitMs.end());
+	stats.submitP95Ms = submitMs[(size_t)((submitMs.size() - 1) * 0.95)];
+	stats.submitMaxMs = submitMs.back();
+	return 0;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <string>
+
+// Records the GL calls the engine makes into a compact binary log, one
+// block per frame, and replays such a log to measure how much CPU time
+// the driver needs to accept a frame's calls.
+//
+// Recording swaps GLEW's function pointers for wrappers that append the
+// call and its arguments to the log and then forward it. Only calls that
+// change state or draw are recorded; queries (glGet*, status checks,
+// timer queries) go straight to the driver. Rules while recording:
+// - one thread issues GL calls at a time (no ResourceLoader),
+// - mapped buffer writes are captured when the buffer is unmapped, so
+//   persistent mappings can't be recorded (StreamBuffer falls back),
+// - program binaries are driver specific, record with the shader cache
+//   off if the log is replayed on another driver.
+//
+// Replay recreates every object, translating the recorded names to the
+// new ones. Uniform locations are replayed as recorded.
+class GLRecorder {
+public:
+	struct ReplayStats {
+		int frames;
+		double callsPerFrame;
+		double submitMeanMs; // issuing the calls of a frame
+		double submitP95Ms;
+		double submitMaxMs;
+		double finishMeanMs; // glFinish after each frame
+		double nsPerCall;
+	};
+
+	// needs GLEW initialized; returns 0 on success like GameWindow::init
+	static int start(const std::string& path);
+	static void stop();
+	static bool isRecording();
+	// closes the current frame's block, called by GameWindow::swapBuffers
+	static void endFrame();
+
+	// Plays the log once, then its frames after the first loops - 1 more
+	// times (frame 0 holds the startup uploads). Framebuffer 0 is mapped
+	// to defaultFramebuffer, e.g. a headless window's offscreen target.
+	static int replay(const std::string& path, GLuint defaultFramebuffer, int loops, ReplayStats& stats);
+};
+
+// GL 1.1 entry points are exported by the GL library itself instead of
+// being loaded by GLEW, so there's no pointer to swap. Files issuing
+// them include this header, which routes them through pointers the same
+// way glew.h does for every later function.
+extern void (GLAPIENTRY* glrecClear)(GLbitfield mask);
+extern void (GLAPIENTRY* glrecClearColor)(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+extern void (GLAPIENTRY* glrecDrawArrays)(GLenum mode, GLint first, GLsizei count);
+extern void (GLAPIENTRY* glrecViewport)(GLint x, GLint y, GLsizei width, GLsizei height);
+extern void (GLAPIENTRY* glrecFlush)(void);
+extern void (GLAPIENTRY* glrecFinish)(void);
+extern void (GLAPIENTRY* glrecPixelStorei)(GLenum pname, GLint param);
+extern void (GLAPIENTRY* glrecReadPixels)(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels);
+
+#ifndef GLRECORDER_NO_REDIRECT
+#define glClear glrecClear
+#define glClearColor glrecClearColor
+#define glDrawArrays glrecDrawArrays
+#define glViewport glrecViewport
+#define glFlush glrecFlush
+#define glFinish glrecFinish
+#define glPixelStorei glrecPixelStorei
+#define glReadPixels glrecReadPixels
+#endif
@@ -1,16 +1,47 @@
 #include "GameClock.h"
 
+#include <cmath>
+#include <thread>
+
 // clock_t is same as long
 // CLOCKS_PER_SEC = clock_t { 1000 }
 
-GameClock::GameClock(double fps) {
+static double toSeconds(std::chrono::steady_clock::duration d) {
+	return std::chrono::duration<double>(d).count();
+}
+
+GameClock::GameClock(double fps, Mode mode) : mode(mode) {
 	cpf = CLOCKS_PER_SEC / fps; // CPF = CPS / FPS
 	last = std::clock();
 	deltaTime = 0;
+
+	period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / fps));
+	lastTick = Clock::now();
+	next = lastTick + period;
+	tickDelta = 0.0;
+
+	// start pessimistic, the estimate converges after a few frames
+	sleepEstimate = 5e-3;
+	sleepMean = 5e-3;
+	sleepM2 = 0.0;
+	sleepCount = 1;
+
+	resetJitterStats();
 }
 
 // returns true if update was skipped
 bool GameClock::update() {
+	if (mode == SLEEP_SPIN) {
+		waitNextFrame();
+		return false;
+	}
+	if (mode == UNCAPPED) {
+		Clock::time_point now = Clock::now();
+		tickDelta = toSeconds(now - lastTick);
+		lastTick = now;
+		return false;
+	}
+
 	if (std::clock() - last >= cpf) {
 		deltaTime = std::clock() - last;
 		last = std::clock();
@@ -19,8 +50,58 @@ bool GameClock::update() {
 	return true;
 }
 
+// Sleeps in 1 ms slices while the remaining time is larger than what
+// a slice is expected to cost (mean + stddev of observed slices), then
+// spins the remainder. Keeps the core idle for most of the frame.
+void GameClock::sleepUntil(Clock::time_point deadline) {
+	while (toSeconds(deadline - Clock::now()) > sleepEstimate) {
+		Clock::time_point start = Clock::now();
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		double observed = toSeconds(Clock::now() - start);
+
+		// Welford update of the sleep cost
+		++sleepCount;
+		double delta = observed - sleepMean;
+		sleepMean += delta / sleepCount;
+		sleepM2 += delta * (observed - sleepMean);
+		sleepEstimate = sleepMean + std::sqrt(sleepM2 / (sleepCount - 1));
+	}
+
+	while (Clock::now() < deadline);
+}
+
+// Blocks until the next frame deadline. Deadlines advance by a fixed
+// period, so oversleeping one frame is paid back by the next one
+// instead of accumulating drift.
+void GameClock::waitNextFrame() {
+	if (Clock::now() < next)
+		sleepUntil(next);
+
+	Clock::time_point now = Clock::now();
+	double late = std::chrono::duration<double, std::micro>(now - next).count();
+
+	if (now - next >= period) {
+		// fell behind by a whole frame, resync instead of bursting
+		++missed;
+		next = now + period;
+	}
+	else {
+		next += period;
+	}
+
+	tickDelta = toSeconds(now - lastTick);
+	lastTick = now;
+
+	++frames;
+	lateSum += late;
+	lateSumSq += late * late;
+	if (late > lateMax) lateMax = late;
+}
+
 float GameClock::getDeltaTime() {
-	return deltaTime / 1000.0f;
+	if (mode != BUSY_WAIT) return (float)tickDelta;
+	// CLOCKS_PER_SEC is 1000 on MSVC but 1000000 on POSIX
+	return deltaTime / (float)CLOCKS_PER_SEC;
 }
 
 long GameClock::getCPF() {
@@ -30,3 +111,32 @@ long GameClock::getCPF() {
 long GameClock::getLast() {
 	return last;
 }
+
+GameClock::Mode GameClock::getMode() {
+	return mode;
+}
+
+void GameClock::setMode(Mode mode) {
+	this->mode = mode;
+	lastTick = Clock::now();
+	next = lastTick + period;
+	last = std::clock();
+}
+
+GameClock::JitterStats GameClock::getJitterStats() {
+	JitterStats stats = { frames, missed, 0.0, lateMax, 0.0 };
+	if (frames > 0) {
+		stats.meanUs = lateSum / frames;
+		double variance = lateSumSq / frames - stats.meanUs * stats.meanUs;
+		stats.stdDevUs = variance > 0.0 ? std::sqrt(variance) : 0.0;
+	}
+	return stats;
+}
+
+void GameClock::resetJitterStats() {
+	frames = 0;
+	missed = 0;
+	lateSum = 0.0;
+	lateSumSq = 0.0;
+	lateMax = 0.0;
+}
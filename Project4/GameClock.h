@@ -1,19 +1,66 @@
 #pragma once
 
 #include <ctime>
+#include <chrono>
 
 // clock_t is same as long
 // CLOCKS_PER_SEC = clock_t { 1000 }
 
 class GameClock {
+public:
+	// BUSY_WAIT  - std::clock() polling, caller spins on update()
+	// SLEEP_SPIN - steady_clock pacer, update() sleeps most of the frame
+	//              and spins only for the last part of it
+	// UNCAPPED   - no pacing, update() only measures the frame delta
+	enum Mode { BUSY_WAIT, SLEEP_SPIN, UNCAPPED };
+
+	// lateness of frame starts against their deadlines, in microseconds
+	struct JitterStats {
+		long frames;
+		long missed;   // frames that overran a whole period
+		double meanUs;
+		double maxUs;
+		double stdDevUs;
+	};
+
 private:
+	typedef std::chrono::steady_clock Clock;
+
 	clock_t cpf;   // clocks per frame
 	clock_t last;  // last update time
 	long deltaTime; // delta time in clocks
+
+	Mode mode;
+	Clock::duration period;     // frame budget
+	Clock::time_point next;     // deadline of the next frame
+	Clock::time_point lastTick; // start of the current frame
+	double tickDelta;           // delta time in seconds (SLEEP_SPIN, UNCAPPED)
+
+	// running estimate of how long a 1 ms sleep really takes
+	double sleepEstimate;
+	double sleepMean;
+	double sleepM2;
+	long sleepCount;
+
+	// jitter accumulators
+	long frames;
+	long missed;
+	double lateSum;
+	double lateSumSq;
+	double lateMax;
+
+	void sleepUntil(Clock::time_point deadline);
+
 public:
-	GameClock(double fps);
+	GameClock(double fps, Mode mode = BUSY_WAIT);
 	bool update();
+	void waitNextFrame();
 	float getDeltaTime();
 	long getCPF();
 	long getLast();
+
+	Mode getMode();
+	void setMode(Mode mode);
+	JitterStats getJitterStats();
+	void resetJitterStats();
 };
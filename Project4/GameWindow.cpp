@@ -1,74 +1,422 @@
 #include "GameWindow.h"
+#include "GLRecorder.h"
+
+#include <algorithm>
+#include <stdlib.h>
+#include <thread>
+
+int GameWindow::glfwUsers = 0;
+bool GameWindow::glewLoaded = false;
+
+static void releaseGlfw(int& users) {
+	if (--users == 0) glfwTerminate();
+}
 
 GameWindow::GameWindow(int width, int height, const std::string& title, float fps) :
-	title(title), width(width), height(height), fps(fps)
+	title(title), width(width), height(height), fps(fps), pacer(fps, GameClock::SLEEP_SPIN)
 { }
 
 bool GameWindow::shouldClose() {
-	return glfwWindowShouldClose(mainWindow);
+	if (frameLimit > 0 && frameCount >= frameLimit) return true;
+	if (closeRequested) return true;
+	// only safe on the thread running the event loop
+	return !threaded && glfwWindowShouldClose(mainWindow);
+}
+
+void GameWindow::requestClose() {
+	closeRequested = true;
+	glfwSetWindowShouldClose(mainWindow, GLFW_TRUE);
+	glfwPostEmptyEvent();
+}
+
+void GameWindow::setHeadless(const std::string& dumpPath, DumpFormat format, int frameLimit) {
+	this->headless = true;
+	this->dumpPath = dumpPath;
+	this->dumpFormat = format;
+	this->frameLimit = frameLimit;
+	this->presentMode = PRESENT_UNCAPPED;
 }
 
 int GameWindow::init(GLFWmonitor* monitor, GLFWwindow* share) {
-	if (!glfwInit())
+#ifndef _WIN32
+	// no display server at all: GLFW null platform + OSMesa (llvmpipe)
+	if (headless && !glfwUsers && !getenv("DISPLAY") && !getenv("WAYLAND_DISPLAY"))
+		glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+#endif
+
+	if (!glfwUsers && !glfwInit())
 	{
 		printf("Error in GLFW init!\n");
 		glfwTerminate();
 		return 1;
 	}
+	glfwUsers++;
+	// the null platform only has OSMesa contexts
+	bool useOSMesa = glfwGetPlatform() == GLFW_PLATFORM_NULL;
 
+	glfwDefaultWindowHints();
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
 	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 	glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 
+	if (headless) {
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+		if (useOSMesa) glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+		monitor = NULL;
+	}
+
 	mainWindow = glfwCreateWindow(width, height, title.c_str(), monitor, share);
 	if (!mainWindow)
 	{
 		printf("Error in GLFW window creation!\n");
-		glfwTerminate();
+		releaseGlfw(glfwUsers);
 		return 1;
 	}
 
 	glfwGetFramebufferSize(mainWindow, &bufferWidth, &bufferHeight);
 
+	glfwSetWindowUserPointer(mainWindow, this);
+	glfwSetKeyCallback(mainWindow, keyCallback);
+	glfwSetMouseButtonCallback(mainWindow, mouseButtonCallback);
+	glfwSetCursorPosCallback(mainWindow, cursorCallback);
+	glfwSetScrollCallback(mainWindow, scrollCallback);
+	glfwSetWindowCloseCallback(mainWindow, closeCallback);
+	// the offscreen target keeps the requested size, dumps need a fixed frame size
+	if (!headless) glfwSetFramebufferSizeCallback(mainWindow, framebufferSizeCallback);
+
 	glfwMakeContextCurrent(mainWindow);
 
-	// checking the vendor + version of OpenGL
+	// GLEW's entry points are process wide, contexts created later are
+	// of the same kind and reuse them
+	if (!glewLoaded) {
+		glewExperimental = GL_TRUE;
+
+		GLenum err = glewInit();
+		if (err != GLEW_OK) {
+			printf("GLEW Error: %s (Code: %u)\n", glewGetErrorString(err), err);
+			// a GLX build of GLEW can't reach the null platform's context
+			if (useOSMesa) printf("Running without a display needs GLEW and GL built for OSMesa (PROJECT4_OSMESA)\n");
+			glfwDestroyWindow(mainWindow);
+			mainWindow = nullptr;
+			releaseGlfw(glfwUsers);
+			return 1;
+		}
+		glewLoaded = true;
+	}
+
+	// checking the vendor + version of OpenGL, GL calls that don't reach
+	// the current context read back null here
 	const GLubyte* version = glGetString(GL_VERSION);
 	if (!version) {
 		printf("No valid OpenGL context after making current!\n");
+		glfwDestroyWindow(mainWindow);
+		mainWindow = nullptr;
+		releaseGlfw(glfwUsers);
+		return 1;
 	}
-	else {
-		printf("OpenGL Version: %s\n", version);
-		printf("Renderer: %s\n", glGetString(GL_RENDERER));
-		printf("Vendor: %s\n", glGetString(GL_VENDOR));
-	}
-
-	glewExperimental = GL_TRUE;
+	printf("OpenGL Version: %s\n", version);
+	printf("Renderer: %s\n", glGetString(GL_RENDERER));
+	printf("Vendor: %s\n", glGetString(GL_VENDOR));
 
-	GLenum err = glewInit();
-	if (err != GLEW_OK) {
-		printf("GLEW Error: %s (Code: %u)\n", glewGetErrorString(err), err);
+	if (headless && createOffscreenTarget()) {
 		glfwDestroyWindow(mainWindow);
-		glfwTerminate();
+		mainWindow = nullptr;
+		releaseGlfw(glfwUsers);
 		return 1;
 	}
 
 	glViewport(0, 0, bufferWidth, bufferHeight);
+	applyPresentMode();
+	return 0;
+}
+
+// the invisible window's default framebuffer may be missing or 1x1,
+// so headless rendering goes into an FBO of the requested size
+int GameWindow::createOffscreenTarget() {
+	bufferWidth = width;
+	bufferHeight = height;
+
+	// stays bound, it replaces the default framebuffer
+	if (offscreen.init(bufferWidth, bufferHeight, GL_RGBA8, false)) {
+		printf("Can't create offscreen framebuffer!\n");
+		return 1;
+	}
+
+	if (!dumpPath.empty()) {
+		dumpFile = fopen(dumpPath.c_str(), "wb");
+		if (!dumpFile) {
+			printf("Can't open frame dump '%s'!\n", dumpPath.c_str());
+			return 1;
+		}
+		pixels.resize((size_t)bufferWidth * bufferHeight * 3);
+	}
 	return 0;
 }
 
+// GL rows are bottom-up, both PPM and raw dumps are written top-down
+void GameWindow::dumpFrame() {
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	glReadPixels(0, 0, bufferWidth, bufferHeight, GL_RGB, GL_UNSIGNED_BYTE, pixels.data());
+
+	if (dumpFormat == DUMP_PPM)
+		fprintf(dumpFile, "P6\n%d %d\n255\n", bufferWidth, bufferHeight);
+
+	size_t stride = (size_t)bufferWidth * 3;
+	for (int y = bufferHeight - 1; y >= 0; y--)
+		fwrite(pixels.data() + y * stride, 1, stride, dumpFile);
+}
+
+void GameWindow::applyPresentMode() {
+	if (headless) {
+		targetInterval = 0.0;
+		return;
+	}
+
+	int refreshRate = 60;
+	GLFWmonitor* monitor = glfwGetPrimaryMonitor();
+	const GLFWvidmode* mode = monitor ? glfwGetVideoMode(monitor) : NULL;
+	if (mode && mode->refreshRate > 0) refreshRate = mode->refreshRate;
+
+	switch (presentMode) {
+	case PRESENT_UNCAPPED:
+		glfwSwapInterval(0);
+		targetInterval = 0.0;
+		break;
+	case PRESENT_VSYNC:
+		glfwSwapInterval(1);
+		targetInterval = 1.0 / refreshRate;
+		break;
+	case PRESENT_ADAPTIVE:
+		if (glfwExtensionSupported("WGL_EXT_swap_control_tear") || glfwExtensionSupported("GLX_EXT_swap_control_tear")) {
+			glfwSwapInterval(-1);
+		}
+		else {
+			printf("Adaptive vsync not supported, using vsync\n");
+			glfwSwapInterval(1);
+		}
+		targetInterval = 1.0 / refreshRate;
+		break;
+	case PRESENT_LOW_LATENCY:
+		glfwSwapInterval(0);
+		targetInterval = 1.0 / fps;
+		pacer.setMode(GameClock::SLEEP_SPIN);
+		break;
+	}
+
+	presentStats = PresentStats();
+	presentStats.targetMs = targetInterval * 1000.0;
+	lastSwapEnd = 0.0;
+}
+
+void GameWindow::beginFrame() {
+	if (presentMode == PRESENT_LOW_LATENCY && !headless)
+		pacer.waitNextFrame();
+	if (resizePending.exchange(false))
+		applyResize();
+}
+
+// Only runs after the callback reported a new size. Renderbuffer storage
+// is re-specified in place (RenderTarget::resize), no glFinish or readback
+// is involved, so a resize costs the same as the allocation itself.
+void GameWindow::applyResize() {
+	uint64_t size = pendingSize;
+	int newWidth = (int)(uint32_t)(size >> 32);
+	int newHeight = (int)(uint32_t)size;
+
+	// minimized, keep the old size until the window is restored
+	if (newWidth <= 0 || newHeight <= 0) return;
+	if (newWidth == bufferWidth && newHeight == bufferHeight) return;
+
+	bufferWidth = newWidth;
+	bufferHeight = newHeight;
+	glViewport(0, 0, bufferWidth, bufferHeight);
+
+	for (RenderTarget* target : sizeDependent)
+		target->resize(bufferWidth, bufferHeight);
+}
+
 int GameWindow::swapBuffers() {
+	frameCount++;
+	GLRecorder::endFrame();
+
+	if (headless) {
+		if (dumpFile) dumpFrame();
+		else glFlush();
+		return 0;
+	}
+
+	double swapStart = glfwGetTime();
 	glfwSwapBuffers(mainWindow);
+	if (presentMode == PRESENT_LOW_LATENCY) glFinish();
+	double swapEnd = glfwGetTime();
+
+	double swapMs = (swapEnd - swapStart) * 1000.0;
+	presentStats.swapMeanMs += (swapMs - presentStats.swapMeanMs) / (presentStats.frames + 1);
+	if (swapMs > presentStats.swapMaxMs) presentStats.swapMaxMs = swapMs;
+
+	if (lastSwapEnd > 0.0) {
+		double interval = swapEnd - lastSwapEnd;
+		presentStats.intervalMeanMs += (interval * 1000.0 - presentStats.intervalMeanMs) / presentStats.frames;
+		if (targetInterval > 0.0 && interval > targetInterval * 1.5) presentStats.missed++;
+	}
+	presentStats.frames++;
+	lastSwapEnd = swapEnd;
 	return 0;
 }
 
 int GameWindow::terminate() {
+	if (offscreen.getId()) {
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		offscreen.destroy();
+	}
+	if (dumpFile) {
+		fclose(dumpFile);
+		dumpFile = nullptr;
+	}
+
+	if (!mainWindow) return 0;
 	glfwDestroyWindow(mainWindow);
-	glfwTerminate();
+	mainWindow = nullptr;
+
+	// loaded entry points stay valid only while a context exists
+	releaseGlfw(glfwUsers);
+	if (!glfwUsers) glewLoaded = false;
+	return 0;
+}
+
+void GameWindow::pushEvent(const InputEvent& event) {
+	if (!events.push(event)) droppedEvents++;
+}
+
+void GameWindow::keyCallback(GLFWwindow* window, int key, int /*scancode*/, int action, int mods) {
+	GameWindow* self = (GameWindow*)glfwGetWindowUserPointer(window);
+	InputEvent event = { InputEvent::KEY, key, action, mods, 0.0, 0.0, glfwGetTime() };
+	self->pushEvent(event);
+}
+
+void GameWindow::mouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
+	GameWindow* self = (GameWindow*)glfwGetWindowUserPointer(window);
+	InputEvent event = { InputEvent::MOUSE_BUTTON, button, action, mods, 0.0, 0.0, glfwGetTime() };
+	self->pushEvent(event);
+}
+
+void GameWindow::cursorCallback(GLFWwindow* window, double x, double y) {
+	GameWindow* self = (GameWindow*)glfwGetWindowUserPointer(window);
+	InputEvent event = { InputEvent::CURSOR, 0, 0, 0, x, y, glfwGetTime() };
+	self->pushEvent(event);
+}
+
+void GameWindow::scrollCallback(GLFWwindow* window, double x, double y) {
+	GameWindow* self = (GameWindow*)glfwGetWindowUserPointer(window);
+	InputEvent event = { InputEvent::SCROLL, 0, 0, 0, x, y, glfwGetTime() };
+	self->pushEvent(event);
+}
+
+void GameWindow::closeCallback(GLFWwindow* window) {
+	GameWindow* self = (GameWindow*)glfwGetWindowUserPointer(window);
+	InputEvent event = { InputEvent::CLOSE, 0, 0, 0, 0.0, 0.0, glfwGetTime() };
+	self->pushEvent(event);
+	self->closeRequested = true;
+}
+
+// may run on the event thread while rendering is threaded
+void GameWindow::framebufferSizeCallback(GLFWwindow* window, int width, int height) {
+	GameWindow* self = (GameWindow*)glfwGetWindowUserPointer(window);
+	self->pendingSize = ((uint64_t)(uint32_t)width << 32) | (uint32_t)height;
+	self->resizePending = true;
+}
+
+int GameWindow::runThreaded(const RenderFunc& render) {
+	std::atomic<bool> renderDone{ false };
+	threaded = true;
+
+	// a context can only be current on one thread at a time
+	glfwMakeContextCurrent(NULL);
+	std::thread renderThread([this, &render, &renderDone] {
+		glfwMakeContextCurrent(mainWindow);
+		render();
+		glfwMakeContextCurrent(NULL);
+
+		renderDone = true;
+		glfwPostEmptyEvent();
+	});
+
+	while (!renderDone)
+		glfwWaitEvents();
+
+	renderThread.join();
+	threaded = false;
+	glfwMakeContextCurrent(mainWindow);
 	return 0;
 }
 
+bool GameWindow::isThreaded() {
+	return threaded;
+}
+
+void GameWindow::pollEvents() {
+	if (!threaded) glfwPollEvents();
+}
+
+bool GameWindow::pollEvent(InputEvent& event) {
+	return events.pop(event);
+}
+
+long GameWindow::getDroppedEvents() {
+	return droppedEvents;
+}
+
+bool GameWindow::isHeadless() {
+	return headless;
+}
+
+void GameWindow::setPresentMode(PresentMode mode) {
+	presentMode = mode;
+	if (mainWindow) applyPresentMode();
+}
+
+GameWindow::PresentMode GameWindow::getPresentMode() {
+	return presentMode;
+}
+
+GameWindow::PresentStats GameWindow::getPresentStats() {
+	return presentStats;
+}
+
+GameClock::JitterStats GameWindow::getPacingStats() {
+	return pacer.getJitterStats();
+}
+
+void GameWindow::addSizeDependent(RenderTarget* target) {
+	target->resize(bufferWidth, bufferHeight);
+	sizeDependent.push_back(target);
+}
+
+void GameWindow::removeSizeDependent(RenderTarget* target) {
+	sizeDependent.erase(std::remove(sizeDependent.begin(), sizeDependent.end(), target), sizeDependent.end());
+}
+
+int GameWindow::getBufferWidth() {
+	return bufferWidth;
+}
+
+int GameWindow::getBufferHeight() {
+	return bufferHeight;
+}
+
+GLuint GameWindow::getDefaultFramebuffer() {
+	return offscreen.getId();
+}
+
+GLFWwindow* GameWindow::getHandle() {
+	return mainWindow;
+}
+
+int GameWindow::getFrameCount() {
+	return frameCount;
+}
+
 float GameWindow::getFPS() {
 	return fps;
 }
@@ -1,12 +1,63 @@
 #pragma once
 
-#include <GL/glew.h>      
+#include <GL/glew.h>
 #include <GLFW/glfw3.h>
+#include <atomic>
+#include <functional>
 #include <string>
+#include <vector>
 #include <stdio.h>
+#include <stdint.h>
+
+#include "GameClock.h"
+#include "RenderTarget.h"
+#include "SpscQueue.h"
+
+// input captured by the GLFW callbacks, time is glfwGetTime() at capture
+struct InputEvent {
+	enum Type { KEY, MOUSE_BUTTON, CURSOR, SCROLL, CLOSE };
+
+	Type type;
+	int code;   // key or mouse button
+	int action; // GLFW_PRESS, GLFW_RELEASE, GLFW_REPEAT
+	int mods;
+	double x;   // cursor position or scroll offset
+	double y;
+	double time;
+};
 
 class GameWindow {
+public:
+	typedef std::function<void()> RenderFunc;
+
+	// how headless frames are written to the dump file
+	// DUMP_PPM - stream of binary P6 images
+	// DUMP_RAW - tightly packed RGB rows, top row first
+	enum DumpFormat { DUMP_PPM, DUMP_RAW };
+
+	// PRESENT_UNCAPPED    - swap interval 0, no pacing
+	// PRESENT_VSYNC       - swap interval 1
+	// PRESENT_ADAPTIVE    - swap interval -1 (late frames tear instead of
+	//                       waiting a whole refresh), vsync if unsupported
+	// PRESENT_LOW_LATENCY - swap interval 0, beginFrame() sleeps until the
+	//                       next fps deadline and swaps are followed by
+	//                       glFinish so no frames queue up in the driver
+	enum PresentMode { PRESENT_UNCAPPED, PRESENT_VSYNC, PRESENT_ADAPTIVE, PRESENT_LOW_LATENCY };
+
+	struct PresentStats {
+		long frames;
+		long missed;          // frame intervals over 1.5x the target
+		double targetMs;      // refresh or fps period, 0 when uncapped
+		double swapMeanMs;    // time spent presenting
+		double swapMaxMs;
+		double intervalMeanMs;
+	};
+
 private:
+	// glfwInit/glewInit run once per process, the last window terminates GLFW
+	static int glfwUsers;
+	static bool glewLoaded;
+
 	std::string title;
 	int width;
 	int height;
@@ -16,14 +67,98 @@ private:
 	int bufferWidth = 0;
 	int bufferHeight = 0;
 
+	// written by the framebuffer size callback (event thread), applied
+	// by beginFrame() on the thread owning the context; width in the high
+	// half, height in the low one, so both are always read as a pair
+	std::atomic<uint64_t> pendingSize{ 0 };
+	std::atomic<bool> resizePending{ false };
+	std::vector<RenderTarget*> sizeDependent;
+
+	// headless mode: invisible context rendering into an FBO
+	bool headless = false;
+	int frameLimit = 0;
+	int frameCount = 0;
+	std::string dumpPath;
+	DumpFormat dumpFormat = DUMP_PPM;
+	FILE* dumpFile = nullptr;
+	std::vector<unsigned char> pixels;
+
+	RenderTarget offscreen;
+
+	// filled on the event thread, drained on the render thread
+	SpscQueue<InputEvent, 1024> events;
+	std::atomic<long> droppedEvents{ 0 };
+	std::atomic<bool> closeRequested{ false };
+	bool threaded = false;
+
+	PresentMode presentMode = PRESENT_VSYNC;
+	GameClock pacer;
+	double targetInterval = 0.0; // seconds
+	double lastSwapEnd = 0.0;
+	PresentStats presentStats = {};
+
+	void applyPresentMode();
+	void applyResize();
+
+	int createOffscreenTarget();
+	void dumpFrame();
+	void pushEvent(const InputEvent& event);
+
+	static void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
+	static void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
+	static void cursorCallback(GLFWwindow* window, double x, double y);
+	static void scrollCallback(GLFWwindow* window, double x, double y);
+	static void closeCallback(GLFWwindow* window);
+	static void framebufferSizeCallback(GLFWwindow* window, int width, int height);
 
 public:
 	GameWindow(int width, int height, const std::string& title, float fps);
-	
+
+	// must be called before init; empty dumpPath renders without dumping,
+	// frameLimit > 0 makes shouldClose() report true after that many frames
+	void setHeadless(const std::string& dumpPath, DumpFormat format, int frameLimit);
+
+	// share: context whose objects (buffers, textures, programs) are shared
 	int init(GLFWmonitor* monitor, GLFWwindow* share);
+	// call once per frame before reading input, paces PRESENT_LOW_LATENCY
+	// and applies a pending resize to the viewport and size-dependent targets
+	void beginFrame();
 	int swapBuffers();
 	int terminate();
 
+	// Hands the GL context to a new render thread running render() and
+	// blocks this thread in glfwWaitEvents until it returns, so input
+	// is captured immediately regardless of the frame rate. The context
+	// is current on the calling thread again afterwards.
+	int runThreaded(const RenderFunc& render);
+	bool isThreaded();
+
+	// single-threaded mode: glfwPollEvents; no-op while threaded
+	void pollEvents();
+	// render side: next captured event, false if none left
+	bool pollEvent(InputEvent& event);
+	long getDroppedEvents();
+
+	// callable from any thread
+	void requestClose();
 	bool shouldClose();
+	bool isHeadless();
+
+	// may be called before init; otherwise needs the context current
+	void setPresentMode(PresentMode mode);
+	PresentMode getPresentMode();
+	PresentStats getPresentStats();
+	GameClock::JitterStats getPacingStats();
+	// targets kept at the framebuffer size, resized lazily in beginFrame();
+	// the window does not own them
+	void addSizeDependent(RenderTarget* target);
+	void removeSizeDependent(RenderTarget* target);
+	int getBufferWidth();
+	int getBufferHeight();
+
+	// what rendering goes to by default: the offscreen target when headless, else 0
+	GLuint getDefaultFramebuffer();
+	GLFWwindow* getHandle();
+	int getFrameCount();
 	float getFPS();
 };
@@ -0,0 +1,129 @@
+#include "JobSystem.h"
+
+#include <chrono>
+
+// queue owned by the running thread, -1 for threads outside the pool
+static thread_local int queueIndex = -1;
+
+JobSystem::~JobSystem() {
+	shutdown();
+}
+
+int JobSystem::init(int threadCount) {
+	if (threadCount <= 0) {
+		threadCount = (int)std::thread::hardware_concurrency() - 1;
+		if (threadCount < 0) threadCount = 0;
+	}
+
+	queues.clear();
+	for (int i = 0; i <= threadCount; i++)
+		queues.emplace_back(new Queue());
+
+	queueIndex = 0;
+	running = true;
+	for (int i = 1; i <= threadCount; i++)
+		threads.emplace_back(&JobSystem::workerLoop, this, i);
+	return 0;
+}
+
+void JobSystem::shutdown() {
+	if (!running) return;
+
+	{
+		std::lock_guard<std::mutex> guard(sleepLock);
+		running = false;
+	}
+	wake.notify_all();
+	for (std::thread& thread : threads)
+		thread.join();
+	threads.clear();
+}
+
+int JobSystem::currentQueue() {
+	return queueIndex >= 0 ? queueIndex : 0;
+}
+
+// own jobs are taken LIFO, they are most likely still in cache
+bool JobSystem::pop(int index, Task& task) {
+	Queue& queue = *queues[index];
+	std::lock_guard<std::mutex> guard(queue.lock);
+	if (queue.tasks.empty()) return false;
+
+	task = std::move(queue.tasks.back());
+	queue.tasks.pop_back();
+	return true;
+}
+
+// stolen jobs are taken FIFO, those are the biggest remaining chunks
+bool JobSystem::steal(int thief, Task& task) {
+	int count = (int)queues.size();
+	for (int i = 1; i < count; i++) {
+		Queue& queue = *queues[(thief + i) % count];
+		std::lock_guard<std::mutex> guard(queue.lock);
+		if (queue.tasks.empty()) continue;
+
+		task = std::move(queue.tasks.front());
+		queue.tasks.pop_front();
+		return true;
+	}
+	return false;
+}
+
+bool JobSystem::runOne(int index) {
+	Task task;
+	if (!pop(index, task) && !steal(index, task)) return false;
+
+	queued--;
+	task.job();
+	task.counter->pending--;
+	return true;
+}
+
+void JobSystem::workerLoop(int index) {
+	queueIndex = index;
+
+	while (running) {
+		if (runOne(index)) continue;
+
+		// timed wait, a missed notify only costs a millisecond
+		std::unique_lock<std::mutex> guard(sleepLock);
+		wake.wait_for(guard, std::chrono::milliseconds(1), [this] { return queued > 0 || !running; });
+	}
+}
+
+void JobSystem::submit(Job job, Counter& counter) {
+	counter.pending++;
+
+	Queue& queue = *queues[currentQueue()];
+	{
+		std::lock_guard<std::mutex> guard(queue.lock);
+		queue.tasks.push_back(Task{ std::move(job), &counter });
+	}
+
+	queued++;
+	wake.notify_one();
+}
+
+// runs other jobs instead of blocking, so nested waits can't deadlock
+void JobSystem::wait(Counter& counter) {
+	int index = currentQueue();
+	while (counter.pending > 0) {
+		if (!runOne(index)) std::this_thread::yield();
+	}
+}
+
+void JobSystem::parallelFor(int count, int grain, int align, const RangeJob& job) {
+	if (grain < align) grain = align;
+	grain = (grain + align - 1) / align * align;
+
+	Counter counter;
+	for (int begin = 0; begin < count; begin += grain) {
+		int end = begin + grain < count ? begin + grain : count;
+		submit([&job, begin, end] { job(begin, end); }, counter);
+	}
+	wait(counter);
+}
+
+int JobSystem::getThreadCount() {
+	return (int)threads.size();
+}
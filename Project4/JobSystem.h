@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Small work-stealing thread pool. Every thread owns a deque: it pushes
+// and pops its own jobs at the back and steals from the front of the
+// others when it runs dry. The thread that called init() owns queue 0
+// and helps with the work while it waits.
+class JobSystem {
+public:
+	typedef std::function<void()> Job;
+	typedef std::function<void(int begin, int end)> RangeJob;
+
+	// jobs submitted with a counter still running or queued
+	struct Counter {
+		std::atomic<int> pending{ 0 };
+	};
+
+private:
+	struct Task {
+		Job job;
+		Counter* counter;
+	};
+
+	struct Queue {
+		std::mutex lock;
+		std::deque<Task> tasks;
+	};
+
+	std::vector<std::unique_ptr<Queue>> queues;
+	std::vector<std::thread> threads;
+	std::atomic<bool> running{ false };
+	std::atomic<int> queued{ 0 };
+	std::mutex sleepLock;
+	std::condition_variable wake;
+
+	int currentQueue();
+	bool pop(int index, Task& task);
+	bool steal(int thief, Task& task);
+	bool runOne(int index);
+	void workerLoop(int index);
+
+public:
+	~JobSystem();
+
+	// threadCount workers besides the calling thread, 0 picks cores - 1
+	int init(int threadCount);
+	void shutdown();
+
+	void submit(Job job, Counter& counter);
+	void wait(Counter& counter);
+
+	// splits [0, count) into chunks of grain (rounded to align) and blocks
+	void parallelFor(int count, int grain, int align, const RangeJob& job);
+
+	int getThreadCount();
+};
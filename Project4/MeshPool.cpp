@@ -0,0 +1,283 @@
+#include "MeshPool.h"
+
+#include <stdio.h>
+
+#include "GLRecorder.h"
+#include "Shader.h"
+
+void FreeList::reset(GLsizei capacity) {
+	blocks.clear();
+	this->capacity = capacity;
+	used = 0;
+	if (capacity > 0) blocks.push_back({ 0, capacity });
+}
+
+void FreeList::grow(GLsizei newCapacity) {
+	if (newCapacity <= capacity) return;
+	release(capacity, newCapacity - capacity);
+	used += newCapacity - capacity; // release() counted the new space as freed
+	capacity = newCapacity;
+}
+
+GLsizei FreeList::allocate(GLsizei size) {
+	for (size_t i = 0; i < blocks.size(); i++) {
+		Block& block = blocks[i];
+		if (block.size < size) continue;
+
+		GLsizei offset = block.offset;
+		block.offset += size;
+		block.size -= size;
+		if (block.size == 0) blocks.erase(blocks.begin() + i);
+		used += size;
+		return offset;
+	}
+	return -1;
+}
+
+void FreeList::release(GLsizei offset, GLsizei size) {
+	size_t i = 0;
+	while (i < blocks.size() && blocks[i].offset < offset) i++;
+
+	bool mergePrev = i > 0 && blocks[i - 1].offset + blocks[i - 1].size == offset;
+	bool mergeNext = i < blocks.size() && offset + size == blocks[i].offset;
+	if (mergePrev && mergeNext) {
+		blocks[i - 1].size += size + blocks[i].size;
+		blocks.erase(blocks.begin() + i);
+	}
+	else if (mergePrev) {
+		blocks[i - 1].size += size;
+	}
+	else if (mergeNext) {
+		blocks[i].offset = offset;
+		blocks[i].size += size;
+	}
+	else {
+		blocks.insert(blocks.begin() + i, { offset, size });
+	}
+	used -= size;
+}
+
+GLsizei FreeList::getCapacity() {
+	return capacity;
+}
+
+GLsizei FreeList::getUsed() {
+	return used;
+}
+
+GLsizei FreeList::getLargestFree() {
+	GLsizei largest = 0;
+	for (const Block& block : blocks)
+		if (block.size > largest) largest = block.size;
+	return largest;
+}
+
+MeshHandle::MeshHandle(MeshHandle&& other) : pool(other.pool), slot(other.slot), generation(other.generation) {
+	other.pool = nullptr;
+	other.slot = -1;
+}
+
+MeshHandle& MeshHandle::operator=(MeshHandle&& other) {
+	if (this != &other) {
+		reset();
+		pool = other.pool;
+		slot = other.slot;
+		generation = other.generation;
+		other.pool = nullptr;
+		other.slot = -1;
+	}
+	return *this;
+}
+
+MeshHandle::~MeshHandle() {
+	reset();
+}
+
+void MeshHandle::reset() {
+	if (pool) pool->release(*this);
+	pool = nullptr;
+	slot = -1;
+}
+
+bool MeshHandle::isValid() {
+	return pool && pool->lookup(*this);
+}
+
+void MeshPool::bindAttributes(Arena& arena) {
+	ProgramState::bindVertexArray(arena.vao);
+	glBindBuffer(GL_ARRAY_BUFFER, arena.buffer);
+	for (int i = 0; i < arena.format.attribCount; i++) {
+		const VertexAttrib& attrib = arena.format.attribs[i];
+		glVertexAttribPointer(attrib.location, attrib.components, GL_FLOAT, GL_FALSE, arena.format.stride, (const void*)(size_t)attrib.offset);
+		glEnableVertexAttribArray(attrib.location);
+	}
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+int MeshPool::addFormat(const VertexFormat& format, GLsizei initialVertices) {
+	if (format.attribCount < 1 || format.attribCount > MAX_ATTRIBS || format.stride <= 0 || initialVertices <= 0) {
+		printf("Invalid vertex format!\n");
+		return -1;
+	}
+
+	Arena arena;
+	arena.format = format;
+	arena.space.reset(initialVertices);
+
+	glGenBuffers(1, &arena.buffer);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, arena.buffer);
+	glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)initialVertices * format.stride, NULL, GL_STATIC_DRAW);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+	glGenVertexArrays(1, &arena.vao);
+	bindAttributes(arena);
+
+	arenas.push_back(arena);
+	return (int)arenas.size() - 1;
+}
+
+void MeshPool::destroy() {
+	for (Arena& arena : arenas) {
+		glDeleteVertexArrays(1, &arena.vao);
+		glDeleteBuffers(1, &arena.buffer);
+	}
+	// the VAOs may be the ones ProgramState thinks are bound
+	if (!arenas.empty()) ProgramState::invalidate();
+	arenas.clear();
+
+	for (Slot& slot : slots) {
+		if (slot.alive) slot.generation++;
+		slot.alive = false;
+	}
+	freeSlots.clear();
+	for (int i = (int)slots.size() - 1; i >= 0; i--) freeSlots.push_back(i);
+	grows = 0;
+}
+
+// Moves the arena into a buffer at least twice as large. The old
+// contents are copied on the GPU and the VAO is pointed at the new
+// buffer, so existing meshes keep their ranges.
+void MeshPool::grow(Arena& arena, GLsizei minVertices) {
+	GLsizei capacity = arena.space.getCapacity();
+	GLsizei newCapacity = capacity * 2;
+	while (newCapacity - capacity < minVertices) newCapacity *= 2;
+
+	GLuint buffer;
+	glGenBuffers(1, &buffer);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+	glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)newCapacity * arena.format.stride, NULL, GL_STATIC_DRAW);
+
+	glBindBuffer(GL_COPY_READ_BUFFER, arena.buffer);
+	glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, (GLsizeiptr)capacity * arena.format.stride);
+	glBindBuffer(GL_COPY_READ_BUFFER, 0);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+	glDeleteBuffers(1, &arena.buffer);
+
+	arena.buffer = buffer;
+	arena.space.grow(newCapacity);
+	bindAttributes(arena);
+	grows++;
+}
+
+MeshHandle MeshPool::allocate(int format, GLsizei vertexCount, GLsizei& first) {
+	MeshHandle handle;
+	if (format < 0 || format >= (int)arenas.size() || vertexCount <= 0) return handle;
+
+	Arena& arena = arenas[format];
+	first = arena.space.allocate(vertexCount);
+	if (first < 0) {
+		grow(arena, vertexCount);
+		first = arena.space.allocate(vertexCount);
+	}
+
+	int index;
+	if (freeSlots.empty()) {
+		index = (int)slots.size();
+		slots.push_back({ 0, 0, 0, 0, false });
+	}
+	else {
+		index = freeSlots.back();
+		freeSlots.pop_back();
+	}
+
+	Slot& slot = slots[index];
+	slot.arena = format;
+	slot.first = first;
+	slot.count = vertexCount;
+	slot.alive = true;
+
+	handle.pool = this;
+	handle.slot = index;
+	handle.generation = slot.generation;
+	return handle;
+}
+
+MeshHandle MeshPool::create(int format, const void* vertices, GLsizei vertexCount) {
+	GLsizei first;
+	MeshHandle handle = allocate(format, vertexCount, first);
+	if (!handle.pool) return handle;
+
+	GLsizei stride = arenas[format].format.stride;
+	glBindBuffer(GL_COPY_WRITE_BUFFER, arenas[format].buffer);
+	glBufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr)first * stride, (GLsizeiptr)vertexCount * stride, vertices);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+	return handle;
+}
+
+MeshHandle MeshPool::createFromBuffer(int format, GLuint source, GLintptr sourceOffset, GLsizei vertexCount) {
+	GLsizei first;
+	MeshHandle handle = allocate(format, vertexCount, first);
+	if (!handle.pool) return handle;
+
+	GLsizei stride = arenas[format].format.stride;
+	glBindBuffer(GL_COPY_READ_BUFFER, source);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, arenas[format].buffer);
+	glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, sourceOffset, (GLintptr)first * stride, (GLsizeiptr)vertexCount * stride);
+	glBindBuffer(GL_COPY_READ_BUFFER, 0);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+	return handle;
+}
+
+MeshPool::Slot* MeshPool::lookup(const MeshHandle& handle) {
+	if (handle.pool != this || handle.slot < 0 || handle.slot >= (int)slots.size()) return nullptr;
+	Slot& slot = slots[handle.slot];
+	if (!slot.alive || slot.generation != handle.generation) return nullptr;
+	return &slot;
+}
+
+// CPU only, handles may outlive the context
+void MeshPool::release(MeshHandle& handle) {
+	Slot* slot = lookup(handle);
+	if (!slot) return;
+
+	arenas[slot->arena].space.release(slot->first, slot->count);
+	slot->alive = false;
+	slot->generation++;
+	freeSlots.push_back(handle.slot);
+}
+
+bool MeshPool::getMesh(const MeshHandle& handle, Mesh& mesh) {
+	Slot* slot = lookup(handle);
+	if (!slot) return false;
+
+	mesh.vao = arenas[slot->arena].vao;
+	mesh.first = slot->first;
+	mesh.count = slot->count;
+	return true;
+}
+
+GLuint MeshPool::getVAO(int format) {
+	if (format < 0 || format >= (int)arenas.size()) return 0;
+	return arenas[format].vao;
+}
+
+MeshPool::Stats MeshPool::getStats() {
+	Stats stats = { 0, (int)arenas.size(), 0, 0, grows };
+	for (Slot& slot : slots)
+		if (slot.alive) stats.meshes++;
+	for (Arena& arena : arenas) {
+		stats.usedVertices += arena.space.getUsed();
+		stats.capacityVertices += arena.space.getCapacity();
+	}
+	return stats;
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <vector>
+
+class MeshPool;
+
+// First-fit allocator over [0, capacity) units. Free blocks are kept
+// sorted by offset and merged with their neighbours on release.
+class FreeList {
+private:
+	struct Block {
+		GLsizei offset;
+		GLsizei size;
+	};
+
+	std::vector<Block> blocks;
+	GLsizei capacity = 0;
+	GLsizei used = 0;
+
+public:
+	void reset(GLsizei capacity);
+	// adds [capacity, newCapacity) as free space
+	void grow(GLsizei newCapacity);
+
+	// returns the offset, -1 if no block is large enough
+	GLsizei allocate(GLsizei size);
+	void release(GLsizei offset, GLsizei size);
+
+	GLsizei getCapacity();
+	GLsizei getUsed();
+	GLsizei getLargestFree();
+};
+
+// Owns a mesh in a MeshPool; the mesh is released with the handle.
+// Handles only move and must not outlive the pool object. A handle whose
+// mesh went away with MeshPool::destroy() is detected by the slot's
+// generation and simply reports invalid.
+class MeshHandle {
+private:
+	MeshPool* pool = nullptr;
+	int slot = -1;
+	unsigned int generation = 0;
+
+	friend class MeshPool;
+
+public:
+	MeshHandle() { }
+	MeshHandle(MeshHandle&& other);
+	MeshHandle& operator=(MeshHandle&& other);
+	MeshHandle(const MeshHandle&) = delete;
+	MeshHandle& operator=(const MeshHandle&) = delete;
+	~MeshHandle();
+
+	void reset();
+	bool isValid();
+};
+
+// Meshes of one vertex format share one large vertex buffer and one VAO;
+// a mesh is just a range of vertices in it, drawn with its first vertex.
+// Creating a mesh uploads into a free range, the buffer doubles (GPU side
+// copy) when none is left, so meshes never need their own GL objects.
+class MeshPool {
+public:
+	static const int MAX_ATTRIBS = 4;
+
+	// float attributes, offsets in bytes
+	struct VertexAttrib {
+		GLuint location;
+		GLint components;
+		GLuint offset;
+	};
+
+	struct VertexFormat {
+		VertexAttrib attribs[MAX_ATTRIBS];
+		int attribCount;
+		GLsizei stride;
+	};
+
+	// what a draw needs, see getMesh()
+	struct Mesh {
+		GLuint vao;
+		GLint first;
+		GLsizei count;
+	};
+
+	struct Stats {
+		int meshes;
+		int formats;
+		GLsizei usedVertices;
+		GLsizei capacityVertices;
+		int grows;
+	};
+
+private:
+	struct Arena {
+		VertexFormat format;
+		GLuint vao;
+		GLuint buffer;
+		FreeList space;
+	};
+
+	struct Slot {
+		int arena;
+		GLsizei first;
+		GLsizei count;
+		unsigned int generation;
+		bool alive;
+	};
+
+	std::vector<Arena> arenas;
+	std::vector<Slot> slots;
+	std::vector<int> freeSlots;
+	int grows = 0;
+
+	void grow(Arena& arena, GLsizei minVertices);
+	void bindAttributes(Arena& arena);
+	MeshHandle allocate(int format, GLsizei vertexCount, GLsizei& first);
+	Slot* lookup(const MeshHandle& handle);
+
+	friend class MeshHandle;
+	void release(MeshHandle& handle);
+
+public:
+	// one buffer + VAO per format; returns the format id, -1 on error
+	int addFormat(const VertexFormat& format, GLsizei initialVertices);
+	void destroy();
+
+	// the handle is invalid for an unknown format or an empty mesh
+	MeshHandle create(int format, const void* vertices, GLsizei vertexCount);
+	// copies vertexCount vertices from another buffer (e.g. one filled by
+	// the ResourceLoader) without a round trip through the CPU
+	MeshHandle createFromBuffer(int format, GLuint source, GLintptr sourceOffset, GLsizei vertexCount);
+
+	// false for stale or empty handles
+	bool getMesh(const MeshHandle& handle, Mesh& mesh);
+	GLuint getVAO(int format);
+	Stats getStats();
+};
@@ -0,0 +1,201 @@
+#include "Profiler.h"
+
+#include <stdio.h>
+#include <algorithm>
+
+void Profiler::enable() {
+	enabled = true;
+	origin = Clock::now();
+}
+
+bool Profiler::isEnabled() {
+	return enabled;
+}
+
+long long Profiler::nowUs() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - origin).count();
+}
+
+// small stable ids read better in the trace viewer than native ones
+int Profiler::threadId() {
+	std::thread::id id = std::this_thread::get_id();
+	std::map<std::thread::id, int>::iterator it = threadIds.find(id);
+	if (it != threadIds.end()) return it->second;
+
+	int index = (int)threadIds.size();
+	threadIds[id] = index;
+	return index;
+}
+
+// expects lock to be held
+void Profiler::record(const char* name, bool gpu, long long startUs, long long durationUs, int thread) {
+	Samples& scope = samples[name];
+	double ms = durationUs / 1000.0;
+	if (scope.ms.size() < maxSamples) scope.ms.push_back(ms);
+	else {
+		scope.ms[scope.next] = ms;
+		scope.next = (scope.next + 1) % maxSamples;
+	}
+
+	if (events.size() < maxEvents) {
+		Event event = { name, gpu, startUs, durationUs, thread };
+		events.push_back(event);
+	}
+}
+
+void Profiler::addCpu(const char* name, long long startUs, long long durationUs) {
+	if (!enabled) return;
+	std::lock_guard<std::mutex> guard(lock);
+	record(name, false, startUs, durationUs, threadId());
+}
+
+void Profiler::beginGpu(const char* name) {
+	if (!enabled || active.name) return;
+
+	GLuint query;
+	if (freeQueries.empty()) glGenQueries(1, &query);
+	else {
+		query = freeQueries.back();
+		freeQueries.pop_back();
+	}
+
+	active.query = query;
+	active.name = name;
+	active.startUs = nowUs();
+	glBeginQuery(GL_TIME_ELAPSED, query);
+}
+
+void Profiler::endGpu() {
+	if (!active.name) return;
+
+	glEndQuery(GL_TIME_ELAPSED);
+	pending.push_back(active);
+	active.name = nullptr;
+}
+
+void Profiler::collectGpu() {
+	if (!enabled) return;
+
+	size_t kept = 0;
+	for (size_t i = 0; i < pending.size(); i++) {
+		GpuQuery& query = pending[i];
+
+		GLint available = 0;
+		glGetQueryObjectiv(query.query, GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available) {
+			pending[kept++] = query;
+			continue;
+		}
+
+		GLuint64 elapsedNs = 0;
+		glGetQueryObjectui64v(query.query, GL_QUERY_RESULT, &elapsedNs);
+		{
+			// GPU events get their own track after the CPU threads
+			std::lock_guard<std::mutex> guard(lock);
+			record(query.name, true, query.startUs, (long long)(elapsedNs / 1000), 1000);
+		}
+		freeQueries.push_back(query.query);
+	}
+	pending.resize(kept);
+}
+
+Profiler::Summary Profiler::getSummary(const std::string& name) {
+	Summary summary = { 0, 0.0, 0.0, 0.0, 0.0 };
+
+	std::vector<double> sorted;
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		std::map<const char*, Samples, NameLess>::iterator it = samples.find(name.c_str());
+		if (it == samples.end() || it->second.ms.empty()) return summary;
+		sorted = it->second.ms;
+	}
+	std::sort(sorted.begin(), sorted.end());
+
+	size_t last = sorted.size() - 1;
+	summary.samples = (int)sorted.size();
+	summary.p50Ms = sorted[last * 50 / 100];
+	summary.p95Ms = sorted[last * 95 / 100];
+	summary.p99Ms = sorted[last * 99 / 100];
+	summary.maxMs = sorted[last];
+	return summary;
+}
+
+void Profiler::printSummary() {
+	if (!enabled) return;
+
+	std::vector<std::string> names;
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		for (auto& entry : samples)
+			names.push_back(entry.first);
+	}
+
+	printf("%-16s %8s %9s %9s %9s %9s\n", "scope", "samples", "p50 ms", "p95 ms", "p99 ms", "max ms");
+	for (const std::string& name : names) {
+		Summary summary = getSummary(name);
+		printf("%-16s %8d %9.3f %9.3f %9.3f %9.3f\n", name.c_str(), summary.samples,
+			summary.p50Ms, summary.p95Ms, summary.p99Ms, summary.maxMs);
+	}
+}
+
+static void writeJsonString(FILE* file, const char* text) {
+	fputc('"', file);
+	for (; *text; text++) {
+		if (*text == '"' || *text == '\\') fputc('\\', file);
+		fputc(*text, file);
+	}
+	fputc('"', file);
+}
+
+int Profiler::writeTrace(const std::string& path) {
+	FILE* file = fopen(path.c_str(), "w");
+	if (!file) {
+		printf("Can't write trace '%s'!\n", path.c_str());
+		return 1;
+	}
+
+	std::lock_guard<std::mutex> guard(lock);
+	fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1000,\"args\":{\"name\":\"GPU\"}}");
+	for (const Event& event : events) {
+		fprintf(file, ",\n{\"name\":");
+		writeJsonString(file, event.name);
+		fprintf(file, ",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":1,\"tid\":%d}",
+			event.gpu ? "gpu" : "cpu", event.startUs, event.durationUs, event.thread);
+	}
+	fprintf(file, "\n]}\n");
+	fclose(file);
+
+	printf("Wrote %zu trace events to '%s'\n", events.size(), path.c_str());
+	return 0;
+}
+
+void Profiler::destroy() {
+	if (active.name) endGpu();
+	for (GpuQuery& query : pending)
+		freeQueries.push_back(query.query);
+	pending.clear();
+
+	if (!freeQueries.empty())
+		glDeleteQueries((GLsizei)freeQueries.size(), freeQueries.data());
+	freeQueries.clear();
+}
+
+ProfileScope::ProfileScope(Profiler& profiler, const char* name) :
+	profiler(profiler), name(name), startUs(profiler.isEnabled() ? profiler.nowUs() : 0)
+{ }
+
+ProfileScope::~ProfileScope() {
+	if (profiler.isEnabled())
+		profiler.addCpu(name, startUs, profiler.nowUs() - startUs);
+}
+
+GpuProfileScope::GpuProfileScope(Profiler& profiler, const char* name) :
+	profiler(profiler)
+{
+	profiler.beginGpu(name);
+}
+
+GpuProfileScope::~GpuProfileScope() {
+	profiler.endGpu();
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+// Collects CPU scopes and GL_TIME_ELAPSED query pairs, keeps the latest
+// samples per name for percentiles and can export everything as a Chrome
+// trace_event JSON file (chrome://tracing, Perfetto).
+// CPU scopes may be recorded from any thread, GPU scopes only on the
+// context thread.
+class Profiler {
+public:
+	struct Summary {
+		int samples;
+		double p50Ms;
+		double p95Ms;
+		double p99Ms;
+		double maxMs;
+	};
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	struct Event {
+		const char* name;
+		bool gpu;
+		long long startUs;
+		long long durationUs;
+		int thread;
+	};
+
+	// GPU timings arrive a few frames late, the CPU start is used as the
+	// event's position on the timeline
+	struct GpuQuery {
+		GLuint query;
+		const char* name;
+		long long startUs;
+	};
+
+	// compares the names, not the pointers: the same literal may have a
+	// copy per translation unit
+	struct NameLess {
+		bool operator()(const char* a, const char* b) const { return strcmp(a, b) < 0; }
+	};
+
+	// the last maxSamples durations of one scope, the oldest is overwritten
+	struct Samples {
+		std::vector<double> ms;
+		size_t next = 0;
+	};
+
+	bool enabled = false;
+	size_t maxEvents = 1000000;
+	size_t maxSamples = 100000;
+	Clock::time_point origin;
+
+	std::mutex lock;
+	std::vector<Event> events;
+	std::map<const char*, Samples, NameLess> samples;
+	std::map<std::thread::id, int> threadIds;
+
+	std::vector<GpuQuery> pending;
+	std::vector<GLuint> freeQueries;
+	GpuQuery active = { 0, nullptr, 0 };
+
+	int threadId();
+	void record(const char* name, bool gpu, long long startUs, long long durationUs, int thread);
+
+public:
+	void enable();
+	bool isEnabled();
+	long long nowUs();
+
+	void addCpu(const char* name, long long startUs, long long durationUs);
+
+	// GL_TIME_ELAPSED queries don't nest, one GPU scope at a time
+	void beginGpu(const char* name);
+	void endGpu();
+	// collects finished GPU queries without waiting on the rest
+	void collectGpu();
+
+	Summary getSummary(const std::string& name);
+	void printSummary();
+	int writeTrace(const std::string& path);
+	void destroy();
+};
+
+// times the enclosing block on the CPU
+class ProfileScope {
+private:
+	Profiler& profiler;
+	const char* name;
+	long long startUs;
+
+public:
+	ProfileScope(Profiler& profiler, const char* name);
+	~ProfileScope();
+};
+
+// times the enclosing block with a GL_TIME_ELAPSED query
+class GpuProfileScope {
+private:
+	Profiler& profiler;
+
+public:
+	GpuProfileScope(Profiler& profiler, const char* name);
+	~GpuProfileScope();
+};
@@ -1,52 +1,82 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <string>
 #include <cmath>
+#include <chrono>
+#include <vector>
 
 #include <GL/glew.h>      
 #include <GLFW/glfw3.h>
 #include <glm/mat4x4.hpp>
 
+#include "BatchRenderer.h"
+#include "CommandBuffer.h"
+#include "Benchmarks.h"
+#include "EntityStore.h"
+#include "FixedTimestep.h"
+#include "GLRecorder.h"
 #include "GameClock.h"
 #include "GameWindow.h"
+#include "JobSystem.h"
+#include "MeshPool.h"
+#include "Profiler.h"
+#include "ResourceLoader.h"
+#include "Shader.h"
+#include "ShaderCache.h"
+#include "ShaderReloader.h"
+#include "ShaderSource.h"
 
 GLint WIDTH = 800, HEIGHT = 600;
 std::string title = "OpenGL Window";
 float FPS = 60.0f;
 
 GameWindow gameWindow(WIDTH, HEIGHT, title, FPS);
-GameClock gameClk(FPS);
-
-GLuint VAO, VBO, shaderId;
-GLuint uniformXMove, uniformYMove;
-bool directionX = true; 
-bool directionY = true;
-float triOffsetX = 0.0f;
-float triOffsetY = 0.0f;
+// pacing is up to the window's present mode, the clock only measures
+GameClock gameClk(FPS, GameClock::UNCAPPED);
+FixedTimestep simStep(120.0);
+ShaderCache shaderCache("shadercache");
+ResourceLoader loader;
+ShaderReloader shaderReloader;
+
+// meshes of one vertex format share a buffer and a VAO
+MeshPool meshes;
+int positionFormat = -1;
+MeshHandle triangleMesh;
+CommandBuffer commands;
+Shader triangleShader;
+ResourceLoader::Request triangleProgramLoad;
+ResourceLoader::Request triangleBufferLoad;
+bool triangleLoaded = false;
+BatchRenderer batch;
+EntityStore entities;
+EntitySnapshots snapshots;
+JobSystem jobs;
+JobSystem::Counter simCounter;
+bool simPending = false;
+float pendingAlpha = 0.0f;
+Profiler profiler;
+int uniformXMove, uniformYMove;
+
+struct BounceState {
+    float offsetX;
+    float offsetY;
+    bool directionX;
+    bool directionY;
+};
+
+// last two simulation states, rendering interpolates between them
+BounceState previousState = { 0.0f, 0.0f, true, true };
+BounceState currentState = previousState;
+
 float triMaxOffsetX = 0.90f;
 float triMaxOffsetY = 0.90f;
 float speedX = 0.5f;
 float speedY = 0.335f;
 
-static const char* vShader = "                              \n\
-#version 330                                                \n\
-                                                            \n\
-layout (location = 0) in vec3 pos;                          \n\
-uniform float xMove;                                        \n\
-uniform float yMove;                                        \n\
-                                                            \n\
-void main() {                                               \n\
-  gl_Position = vec4(pos.x + xMove, pos.y + yMove, pos.z, 1.0);     \n\
-}                                                           \n\
-";
-
-static const char* fShader = "                              \n\
-#version 330                                                \n\
-                                                            \n\
-out vec4 colour;                                            \n\
-void main() {                                               \n\
-  colour = vec4(1.0, 0.0, 0.0, 1.0);                        \n\
-}                                                           \n\
-";
+// relative to the working directory, edits are picked up while running
+static const char* vShaderPath = "shaders/triangle.vert";
+static const char* fShaderPath = "shaders/triangle.frag";
 
 GLfloat triangle1[] = {
     -0.1f, -0.1f, 0.0f,
@@ -54,127 +84,335 @@ GLfloat triangle1[] = {
      0.0f,  0.1f, 0.0f,
 };
 
-void CreateTriangle(GLfloat vertices[], GLsizei vertexCount) {
-    glGenVertexArrays(1, &VAO);
-    glBindVertexArray(VAO);
-
-    glGenBuffers(1, &VBO);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+int CreateMeshFormats() {
+    MeshPool::VertexFormat position = {};
+    position.attribs[0] = { 0, 3, 0 };
+    position.attribCount = 1;
+    position.stride = 3 * sizeof(GLfloat);
 
-    glBufferData(GL_ARRAY_BUFFER, vertexCount * sizeof(GLfloat), vertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, 0);
+    positionFormat = meshes.addFormat(position, 4096);
+    return positionFormat < 0;
+}
 
-    glEnableVertexAttribArray(0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+// the buffer was filled on the loader context; its vertices are copied
+// into the mesh pool on the GPU and the buffer is dropped
+void CreateTriangle(GLuint buffer) {
+    triangleMesh = meshes.createFromBuffer(positionFormat, buffer, 0, 3);
+    glDeleteBuffers(1, &buffer);
 }
 
-void AddShader(GLuint &shaderId, const char* code, GLenum type) {
-    GLuint subShaderId = glCreateShader(type);
+struct Options {
+    bool headless = false;
+    int frames = 0;
+    std::string dumpPath;
+    GameWindow::DumpFormat dumpFormat = GameWindow::DUMP_PPM;
+    int instances = 0;
+    int benchInstances = 0;
+    int benchEntities = 0;
+    int threads = 0;
+    bool profile = false;
+    std::string tracePath;
+    bool threadedInput = false;
+    GameWindow::PresentMode presentMode = GameWindow::PRESENT_LOW_LATENCY;
+    std::string recordPath;
+    std::string replayPath;
+    int replayLoops = 1;
+};
 
-    const GLchar* shaderCode[1];
-    shaderCode[0] = code;
+// --headless [--frames N] [--dump <file|fifo>] [--raw]
+// --instances N        also draw N bouncing triangles in one instanced batch
+// --bench-instances N  time batches of 1k, 10k... up to N instances and exit
+// --bench-entities N   compare scalar and SIMD entity updates up to N and exit
+// --threads N          simulation worker threads, default is cores - 1
+// --profile            print p50/p95/p99 of the frame scopes on exit
+// --trace <file>       also write a Chrome trace_event JSON file
+// --threaded-input     wait for input on the main thread, render on another
+// --present <mode>     uncapped, vsync, adaptive or lowlatency (default)
+// --record <file>      log every frame's GL calls (see GLRecorder)
+// --replay <file> [--replay-loops N]  time a log's calls headless and exit
+Options ParseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--headless")) options.headless = true;
+        else if (!strcmp(argv[i], "--frames") && i + 1 < argc) options.frames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--dump") && i + 1 < argc) options.dumpPath = argv[++i];
+        else if (!strcmp(argv[i], "--raw")) options.dumpFormat = GameWindow::DUMP_RAW;
+        else if (!strcmp(argv[i], "--instances") && i + 1 < argc) options.instances = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--bench-instances") && i + 1 < argc) options.benchInstances = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--bench-entities") && i + 1 < argc) options.benchEntities = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--threads") && i + 1 < argc) options.threads = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--profile")) options.profile = true;
+        else if (!strcmp(argv[i], "--trace") && i + 1 < argc) options.tracePath = argv[++i];
+        else if (!strcmp(argv[i], "--threaded-input")) options.threadedInput = true;
+        else if (!strcmp(argv[i], "--record") && i + 1 < argc) options.recordPath = argv[++i];
+        else if (!strcmp(argv[i], "--replay") && i + 1 < argc) options.replayPath = argv[++i];
+        else if (!strcmp(argv[i], "--replay-loops") && i + 1 < argc) options.replayLoops = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--present") && i + 1 < argc) {
+            const char* mode = argv[++i];
+            if (!strcmp(mode, "uncapped")) options.presentMode = GameWindow::PRESENT_UNCAPPED;
+            else if (!strcmp(mode, "vsync")) options.presentMode = GameWindow::PRESENT_VSYNC;
+            else if (!strcmp(mode, "adaptive")) options.presentMode = GameWindow::PRESENT_ADAPTIVE;
+            else if (!strcmp(mode, "lowlatency")) options.presentMode = GameWindow::PRESENT_LOW_LATENCY;
+            else printf("Unknown present mode '%s'\n", mode);
+        }
+        else printf("Unknown option '%s'\n", argv[i]);
+    }
+    return options;
+}
 
-    GLint codeLength[1];
-    codeLength[0] = strlen(code);
+void StepSimulation(BounceState& state, float dt) {
+    if (state.directionX) state.offsetX += speedX * dt;
+    else state.offsetX -= speedX * dt;
 
-    glShaderSource(subShaderId, 1, shaderCode, codeLength);
-    glCompileShader(subShaderId);
+    if (state.directionY) state.offsetY += speedY * dt;
+    else state.offsetY -= speedY * dt;
 
-    GLint result = 0;
-    GLchar errorLog[1024] = { 0 };
+    if (abs(state.offsetX) >= triMaxOffsetX)
+        state.directionX = !state.directionX;
+    if (abs(state.offsetY) >= triMaxOffsetY)
+        state.directionY = !state.directionY;
+}
 
-    glGetShaderiv(subShaderId, GL_COMPILE_STATUS, &result);
-    if (!result) {
-        glGetShaderInfoLog(subShaderId, sizeof(errorLog), NULL, errorLog);
-        printf("   '%d': '%s'\n", type, errorLog);
-        glDeleteShader(subShaderId);
-        return;
+// Runs on the job system while the main thread renders the front
+// snapshot: steps the entities, then captures them into the back one.
+void SimulateEntities(int steps, float dt) {
+    ProfileScope simulate(profiler, "simulate");
+    const int grain = 16384;
+    int count = entities.getCount();
+
+    for (int i = 0; i < steps; i++) {
+        jobs.parallelFor(count, grain, EntityStore::LANES,
+            [dt](int begin, int end) {
+                ProfileScope chunk(profiler, "update chunk");
+                entities.update(begin, end, dt);
+            });
     }
 
-    glAttachShader(shaderId, subShaderId);
-    glDeleteShader(subShaderId);
+    EntityView view = entities.view();
+    jobs.parallelFor(count, grain, EntityStore::LANES,
+        [&view](int begin, int end) { snapshots.capture(view, begin, end); });
 }
 
-void CompileShaders(GLuint &shaderId, const char* vert, const char* frag) {
-    shaderId = glCreateProgram();
-
-    if (!shaderId) {
-        printf("    !\n");
-        return;
-    }
+void FetchTriangleUniforms() {
+    uniformXMove = triangleShader.getUniform("xMove");
+    uniformYMove = triangleShader.getUniform("yMove");
+}
 
-    AddShader(shaderId, vert, GL_VERTEX_SHADER);
-    AddShader(shaderId, frag, GL_FRAGMENT_SHADER);
+// The triangle's program and vertex buffer are built on the loader
+// thread; frames are drawn without it until both have arrived
+void PollTriangleLoad() {
+    if (triangleLoaded) return;
 
-    GLint result = 0;
-    GLchar errorLog[1024] = { 0 };
+    ResourceLoader::Status program = loader.poll(triangleProgramLoad);
+    ResourceLoader::Status buffer = loader.poll(triangleBufferLoad);
+    if (program == ResourceLoader::PENDING || buffer == ResourceLoader::PENDING) return;
 
-    glLinkProgram(shaderId);
-    glGetProgramiv(shaderId, GL_LINK_STATUS, &result);
-    if (!result) {
-        glGetProgramInfoLog(shaderId, sizeof(errorLog), NULL, errorLog);
-        printf("  : '%s'\n", errorLog);
-        glDeleteProgram(shaderId);
+    triangleLoaded = true;
+    if (program == ResourceLoader::FAILED || buffer == ResourceLoader::FAILED) {
+        printf("Loading the triangle failed!\n");
+        gameWindow.requestClose();
         return;
     }
 
-    glValidateProgram(shaderId);
-    glGetProgramiv(shaderId, GL_VALIDATE_STATUS, &result);
-    if (!result) {
-        glGetProgramInfoLog(shaderId, sizeof(errorLog), NULL, errorLog);
-        printf("  : '%s'\n", errorLog);
-        glDeleteProgram(shaderId);
-        return;
-    }
+    triangleShader.adopt(triangleProgramLoad.name);
+    FetchTriangleUniforms();
+    CreateTriangle(triangleBufferLoad.name);
+    shaderReloader.add(triangleShader, vShaderPath, fShaderPath, FetchTriangleUniforms);
+}
 
-    uniformXMove = glGetUniformLocation(shaderId, "xMove");
-    uniformYMove = glGetUniformLocation(shaderId, "yMove");
+void HandleInput(const InputEvent& event) {
+    if (event.type == InputEvent::KEY && event.code == GLFW_KEY_ESCAPE && event.action == GLFW_PRESS)
+        gameWindow.requestClose();
 }
 
-int main() {
-    gameWindow.init(NULL, NULL);
+// Runs until the window closes, on the main thread or on the render
+// thread when input is handled on a separate one
+void RenderLoop() {
+    while (!gameWindow.shouldClose()) {
+        {
+            ProfileScope pace(profiler, "pace");
+            gameWindow.beginFrame();
+            if (gameClk.update()) continue;
+        }
+
+        ProfileScope frame(profiler, "frame");
+        gameWindow.pollEvents();
+
+        InputEvent event;
+        while (gameWindow.pollEvent(event))
+            HandleInput(event);
+
+        shaderReloader.update();
+
+        float triOffsetX, triOffsetY;
+        {
+            ProfileScope update(profiler, "update");
+
+            // Fixed step movement, independent of the render rate
+            int steps = simStep.advance(gameClk.getDeltaTime());
+            for (int i = 0; i < steps; i++) {
+                previousState = currentState;
+                StepSimulation(currentState, simStep.getStep());
+            }
+
+            float alpha = simStep.getAlpha();
+            triOffsetX = previousState.offsetX + (currentState.offsetX - previousState.offsetX) * alpha;
+            triOffsetY = previousState.offsetY + (currentState.offsetY - previousState.offsetY) * alpha;
+
+            // Entities are simulated one frame ahead on the worker threads,
+            // the renderer only sees snapshots the simulation has finished
+            if (entities.getCount() > 0) {
+                if (simPending) {
+                    ProfileScope wait(profiler, "sim wait");
+                    jobs.wait(simCounter);
+                    snapshots.publish(entities.getCount(), pendingAlpha);
+                }
+
+                float dt = simStep.getStep();
+                jobs.submit([steps, dt] { SimulateEntities(steps, dt); }, simCounter);
+                pendingAlpha = alpha;
+                simPending = true;
+            }
+        }
+
+        {
+            ProfileScope draw(profiler, "draw");
+            GpuProfileScope gpuDraw(profiler, "draw (gpu)");
+
+            glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+
+            // draws are recorded, sorted by program and VAO, then run;
+            // binds and uploads are skipped when nothing changed
+            PollTriangleLoad();
+            commands.clear();
+            MeshPool::Mesh mesh;
+            if (meshes.getMesh(triangleMesh, mesh)) {
+                commands.draw(CommandBuffer::makeKey(0, triangleShader.getId(), mesh.vao, 0), triangleShader, mesh.vao, GL_TRIANGLES, mesh.first, mesh.count);
+                commands.setFloat(uniformXMove, triOffsetX);
+                commands.setFloat(uniformYMove, triOffsetY);
+            }
+            batch.record(commands, 0, snapshots.getFront(), snapshots.getFrontAlpha());
+
+            commands.sort();
+            commands.execute();
+            batch.fence();
+        }
+
+        {
+            ProfileScope swap(profiler, "swap");
+            gameWindow.swapBuffers();
+        }
+        profiler.collectGpu();
+    }
+}
 
-    CompileShaders(shaderId, vShader, fShader);
-    CreateTriangle(triangle1, 9);
+int main(int argc, char** argv) {
+    Options options = ParseOptions(argc, argv);
+    jobs.init(options.threads);
+    if (options.profile || !options.tracePath.empty()) profiler.enable();
 
-    while (!gameWindow.shouldClose()) {
-        if (gameClk.update()) continue;
+    if (options.benchEntities > 0) {
+        entities.init(options.benchEntities);
+        return RunEntityBenchmark(entities, jobs, 1000);
+    }
 
-        glfwPollEvents();
+    if (!options.replayPath.empty()) {
+        gameWindow.setHeadless("", GameWindow::DUMP_PPM, 0);
+        if (gameWindow.init(NULL, NULL)) return 1;
+        int result = RunReplayBenchmark(gameWindow, options.replayPath, options.replayLoops);
+        gameWindow.terminate();
+        return result;
+    }
 
-        // Proper movement with deltaTime
-        if (directionX) triOffsetX += speedX * gameClk.getDeltaTime();
-        else triOffsetX -= speedX * gameClk.getDeltaTime();
+    // batch runs measure throughput, headless frames are never paced
+    gameWindow.setPresentMode(options.presentMode);
+    if (options.headless)
+        gameWindow.setHeadless(options.dumpPath, options.dumpFormat, options.frames);
+
+    if (gameWindow.init(NULL, NULL)) return 1;
+    auto startTime = std::chrono::steady_clock::now();
+
+    // recording needs every call on this thread, and program binaries
+    // would tie the log to this driver
+    bool recording = !options.recordPath.empty();
+    if (recording && GLRecorder::start(options.recordPath)) return 1;
+    ShaderCache* cache = recording ? NULL : &shaderCache;
+
+    std::string vShader, fShader;
+    std::vector<std::string> shaderFiles;
+    if (!ShaderSource::load(vShaderPath, vShader, shaderFiles) || !ShaderSource::load(fShaderPath, fShader, shaderFiles))
+        return 1;
+    if (shaderReloader.init()) return 1;
+    if (CreateMeshFormats()) return 1;
+
+    if (recording) {
+        if (triangleShader.compile(vShader.c_str(), fShader.c_str(), NULL)) return 1;
+        FetchTriangleUniforms();
+        triangleMesh = meshes.create(positionFormat, triangle1, 3);
+        shaderReloader.add(triangleShader, vShaderPath, fShaderPath, FetchTriangleUniforms);
+        triangleLoaded = true;
+    }
+    else {
+        // the first frames don't wait for the triangle, see PollTriangleLoad
+        if (loader.init(gameWindow, &shaderCache)) return 1;
+        loader.buildProgram(triangleProgramLoad, vShader.c_str(), fShader.c_str());
+        loader.uploadBuffer(triangleBufferLoad, GL_ARRAY_BUFFER, triangle1, sizeof(triangle1), GL_STATIC_DRAW);
+    }
 
-        if (directionY) triOffsetY += speedY * gameClk.getDeltaTime();
-        else triOffsetY -= speedY * gameClk.getDeltaTime();
+    int batchCapacity = options.benchInstances > 0 ? options.benchInstances : options.instances;
+    if (batchCapacity > 0) {
+        entities.init(batchCapacity);
+        entities.spawn(options.instances, 1234u);
+        if (batch.init(cache, triangle1, 3, entities.getCapacity())) return 1;
+        batch.watch(shaderReloader);
 
-        if (abs(triOffsetX) >= triMaxOffsetX) 
-            directionX = !directionX;
-        if (abs(triOffsetY) >= triMaxOffsetY)
-            directionY = !directionY;
+        snapshots.init(entities.getCapacity());
+        snapshots.capture(entities.view(), 0, entities.getCount());
+        snapshots.publish(entities.getCount(), 0.0f);
+    }
 
-        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
+    if (options.benchInstances > 0) {
+        int result = RunInstanceBenchmark(gameWindow, batch, entities, 200);
+        GLRecorder::stop();
+        batch.destroy();
+        meshes.destroy();
+        loader.destroy();
+        gameWindow.terminate();
+        return result;
+    }
 
-        glUseProgram(shaderId);
-        glBindVertexArray(VAO);
-        
-        glUniform1f(uniformXMove, triOffsetX);
-        glUniform1f(uniformYMove, triOffsetY);
-        
-        glDrawArrays(GL_TRIANGLES, 0, 3);
+    if (options.threadedInput) gameWindow.runThreaded(RenderLoop);
+    else RenderLoop();
 
-        glBindVertexArray(0);
-        glUseProgram(0);
+    jobs.wait(simCounter);
+    jobs.shutdown();
+    GLRecorder::stop();
 
-        gameWindow.swapBuffers();
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    printf("Rendered %d frames in %.2f s (%.1f fps)\n",
+        gameWindow.getFrameCount(), elapsed, gameWindow.getFrameCount() / elapsed);
+
+    GameWindow::PresentStats present = gameWindow.getPresentStats();
+    printf("Present: %ld frames, %ld missed (target %.2f ms), swap mean %.3f ms, max %.3f ms, interval mean %.3f ms\n",
+        present.frames, present.missed, present.targetMs, present.swapMeanMs, present.swapMaxMs, present.intervalMeanMs);
+
+    GameClock::JitterStats jitter = gameWindow.getPacingStats();
+    if (jitter.frames > 0) {
+        printf("Frame pacing: %ld frames, %ld missed, jitter mean %.1f us, max %.1f us, stddev %.1f us\n",
+            jitter.frames, jitter.missed, jitter.meanUs, jitter.maxUs, jitter.stdDevUs);
     }
 
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
-    glDeleteProgram(shaderId);
+    profiler.printSummary();
+    if (!options.tracePath.empty()) profiler.writeTrace(options.tracePath);
+    profiler.destroy();
+
+    triangleMesh.reset();
+    meshes.destroy();
+    triangleShader.destroy();
+    batch.destroy();
+    shaderReloader.destroy();
+    loader.destroy();
     gameWindow.terminate();
 
     return 0;
@@ -0,0 +1,306 @@
+// Benchmarks for the engine classes, results are printed as JSON.
+//
+// pacing    - GameClock deadline accuracy and CPU use per mode and rate
+// frame_cpu - wall time of one frame's CPU work: entity simulation on
+//             the job system plus, with GL, recording, sorting and
+//             submitting the draws into a headless window
+// startup   - window + context creation, shader builds, first frame (GL only)
+// bulk_math - BulkMath kernels for every ISA the host supports, ns per
+//             element and the largest deviation from the generic path
+//
+// Project4Bench [--frames N] [--entities N] [--threads N] [--elements N] [--out <file>]
+// Shaders are loaded from ./shaders, run it from the Project4 directory.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include "BulkMath.h"
+#include "EntityStore.h"
+#include "GameClock.h"
+#include "JobSystem.h"
+
+#ifdef PROJECT4_BENCH_GL
+#include "BatchRenderer.h"
+#include "CommandBuffer.h"
+#include "GLRecorder.h"
+#include "GameWindow.h"
+#endif
+
+struct BenchOptions {
+    int frames = 300;
+    int entities = 100000;
+    int threads = 0;
+    int elements = 1 << 20;
+    std::string outPath;
+};
+
+struct FrameTimes {
+    double meanMs = 0.0;
+    double p50Ms = 0.0;
+    double p95Ms = 0.0;
+    double p99Ms = 0.0;
+    double maxMs = 0.0;
+};
+
+static double nowMs() {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static FrameTimes Summarize(std::vector<double> samples) {
+    FrameTimes times;
+    if (samples.empty()) return times;
+
+    double total = 0.0;
+    for (double ms : samples) total += ms;
+    std::sort(samples.begin(), samples.end());
+
+    size_t last = samples.size() - 1;
+    times.meanMs = total / samples.size();
+    times.p50Ms = samples[(size_t)(last * 0.50)];
+    times.p95Ms = samples[(size_t)(last * 0.95)];
+    times.p99Ms = samples[(size_t)(last * 0.99)];
+    times.maxMs = samples[last];
+    return times;
+}
+
+static void WriteTimes(FILE* out, const FrameTimes& times) {
+    fprintf(out, "\"mean_ms\": %.4f, \"p50_ms\": %.4f, \"p95_ms\": %.4f, \"p99_ms\": %.4f, \"max_ms\": %.4f",
+        times.meanMs, times.p50Ms, times.p95Ms, times.p99Ms, times.maxMs);
+}
+
+// Paces `frames` frames and reports how late they started. CPU use is
+// process CPU time over wall time, so BUSY_WAIT shows up near 100%.
+static void BenchPacing(FILE* out, GameClock::Mode mode, const char* name, double fps, int frames, bool last) {
+    GameClock clock(fps, mode);
+    clock.resetJitterStats();
+
+    std::clock_t cpuStart = std::clock();
+    double wallStart = nowMs();
+    for (int i = 0; i < frames; i++) {
+        if (mode == GameClock::BUSY_WAIT) {
+            // the std::clock() cap has no jitter stats, time the frames here
+            while (clock.update());
+        }
+        else {
+            clock.waitNextFrame();
+        }
+    }
+    double wallMs = nowMs() - wallStart;
+    double cpuMs = (std::clock() - cpuStart) * 1000.0 / CLOCKS_PER_SEC;
+
+    GameClock::JitterStats jitter = clock.getJitterStats();
+    fprintf(out, "    {\"mode\": \"%s\", \"fps\": %.0f, \"frames\": %d, \"wall_fps\": %.2f, \"cpu_percent\": %.1f",
+        name, fps, frames, frames * 1000.0 / wallMs, cpuMs * 100.0 / wallMs);
+    if (mode != GameClock::BUSY_WAIT) {
+        fprintf(out, ", \"missed\": %ld, \"late_mean_us\": %.1f, \"late_max_us\": %.1f, \"late_stddev_us\": %.1f",
+            jitter.missed, jitter.meanUs, jitter.maxUs, jitter.stdDevUs);
+    }
+    fprintf(out, "}%s\n", last ? "" : ",");
+}
+
+static void SimulateFrame(EntityStore& entities, EntitySnapshots& snapshots, JobSystem& jobs, float dt) {
+    int count = entities.getCount();
+    jobs.parallelFor(count, 16384, EntityStore::LANES,
+        [&entities, dt](int begin, int end) { entities.update(begin, end, dt); });
+
+    EntityView view = entities.view();
+    jobs.parallelFor(count, 16384, EntityStore::LANES,
+        [&snapshots, &view](int begin, int end) { snapshots.capture(view, begin, end); });
+    snapshots.publish(count, 0.0f);
+}
+
+// best of a few passes, in ns per element
+template <typename Kernel>
+static double TimeKernel(int count, Kernel kernel) {
+    double best = 0.0;
+    for (int pass = 0; pass < 5; pass++) {
+        double start = nowMs();
+        kernel();
+        double ms = nowMs() - start;
+        if (pass == 0 || ms < best) best = ms;
+    }
+    return best * 1e6 / count;
+}
+
+static float MaxDifference(const std::vector<float>& a, const std::vector<float>& b) {
+    float worst = 0.0f;
+    for (size_t i = 0; i < a.size(); i++) worst = std::max(worst, std::abs(a[i] - b[i]));
+    return worst;
+}
+
+static void BenchBulkMath(FILE* out, int count) {
+    const float matrix[16] = {
+        0.8f, 0.6f, 0.0f, 0.0f,
+        -0.6f, 0.8f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        3.0f, -2.0f, 5.0f, 1.0f,
+    };
+    std::vector<float> vectors(count * 4), x(count), y(count);
+    for (int i = 0; i < count; i++) {
+        float f = (float)i;
+        vectors[i * 4 + 0] = std::sin(f * 0.37f);
+        vectors[i * 4 + 1] = std::cos(f * 0.11f);
+        vectors[i * 4 + 2] = std::sin(f * 0.05f) * 2.0f;
+        vectors[i * 4 + 3] = 1.0f;
+        x[i] = f * 0.013f - 50.0f;
+        y[i] = std::cos(f * 0.001f) * 20.0f;
+    }
+
+    const BulkMath::Kernels* generic = BulkMath::get(BulkMath::GENERIC);
+    std::vector<float> transformed(count * 4), normalized(count * 4), noise(count);
+    std::vector<uint32_t> packed(count);
+    generic->transform(matrix, vectors.data(), transformed.data(), count);
+    generic->normalize(vectors.data(), normalized.data(), count);
+    generic->packUnorm4x8(vectors.data(), packed.data(), count);
+    generic->simplex2(x.data(), y.data(), noise.data(), count);
+
+    std::vector<float> floats(count * 4), noiseOut(count);
+    std::vector<uint32_t> packedOut(count);
+    BulkMath::Isa detected = BulkMath::detect();
+    fprintf(out, "  \"bulk_math\": {\"elements\": %d, \"detected\": \"%s\", \"isa\": [\n", count, BulkMath::getName(detected));
+    for (int isa = BulkMath::GENERIC; isa <= detected; isa++) {
+        const BulkMath::Kernels* kernels = BulkMath::get((BulkMath::Isa)isa);
+        float error = 0.0f;
+
+        double transformNs = TimeKernel(count, [&]() { kernels->transform(matrix, vectors.data(), floats.data(), count); });
+        error = std::max(error, MaxDifference(floats, transformed));
+        double normalizeNs = TimeKernel(count, [&]() { kernels->normalize(vectors.data(), floats.data(), count); });
+        error = std::max(error, MaxDifference(floats, normalized));
+        double simplexNs = TimeKernel(count, [&]() { kernels->simplex2(x.data(), y.data(), noiseOut.data(), count); });
+        error = std::max(error, MaxDifference(noiseOut, noise));
+        double packNs = TimeKernel(count, [&]() { kernels->packUnorm4x8(vectors.data(), packedOut.data(), count); });
+        int packMismatches = 0;
+        for (int i = 0; i < count; i++) packMismatches += packedOut[i] != packed[i];
+
+        fprintf(out, "    {\"isa\": \"%s\", \"transform_ns\": %.3f, \"normalize_ns\": %.3f, \"pack_unorm4x8_ns\": %.3f, \"simplex2_ns\": %.3f, \"max_error\": %g, \"pack_mismatches\": %d}%s\n",
+            BulkMath::getName(kernels->isa), transformNs, normalizeNs, packNs, simplexNs, error, packMismatches, isa == detected ? "" : ",");
+    }
+    fprintf(out, "  ]},\n");
+}
+
+static BenchOptions ParseOptions(int argc, char** argv) {
+    BenchOptions options;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--frames") && i + 1 < argc) options.frames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--entities") && i + 1 < argc) options.entities = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--threads") && i + 1 < argc) options.threads = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--elements") && i + 1 < argc) options.elements = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--out") && i + 1 < argc) options.outPath = argv[++i];
+        else fprintf(stderr, "Unknown option '%s'\n", argv[i]);
+    }
+    return options;
+}
+
+int main(int argc, char** argv) {
+    double processStart = nowMs();
+    BenchOptions options = ParseOptions(argc, argv);
+
+    FILE* out = stdout;
+    if (!options.outPath.empty()) {
+        out = fopen(options.outPath.c_str(), "w");
+        if (!out) {
+            fprintf(stderr, "Can't write '%s'!\n", options.outPath.c_str());
+            return 1;
+        }
+    }
+
+    JobSystem jobs;
+    jobs.init(options.threads);
+
+    EntityStore entities;
+    EntitySnapshots snapshots;
+    entities.init(options.entities);
+    entities.spawn(options.entities, 1234u);
+    snapshots.init(entities.getCapacity());
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"threads\": %d,\n", jobs.getThreadCount());
+
+#ifdef PROJECT4_BENCH_GL
+    // startup: everything a launch does before the first frame is shown
+    static GLfloat triangle[] = {
+        -0.1f, -0.1f, 0.0f,
+         0.1f, -0.1f, 0.0f,
+         0.0f,  0.1f, 0.0f,
+    };
+
+    GameWindow window(800, 600, "Project4Bench", 60.0f);
+    BatchRenderer batch;
+    CommandBuffer commands;
+
+    double initStart = nowMs();
+    window.setHeadless("", GameWindow::DUMP_PPM, 0);
+    if (window.init(NULL, NULL)) return 1;
+    double windowMs = nowMs() - initStart;
+
+    double shaderStart = nowMs();
+    if (batch.init(NULL, triangle, 3, entities.getCapacity())) return 1;
+    double shaderMs = nowMs() - shaderStart;
+
+    double firstFrameStart = nowMs();
+    SimulateFrame(entities, snapshots, jobs, 1.0f / 120.0f);
+    batch.draw(snapshots.getFront(), 0.0f);
+    window.swapBuffers();
+    glFinish();
+    double firstFrameMs = nowMs() - firstFrameStart;
+
+    fprintf(out, "  \"startup\": {\"window_ms\": %.3f, \"shaders_ms\": %.3f, \"first_frame_ms\": %.3f, \"since_launch_ms\": %.3f},\n",
+        windowMs, shaderMs, firstFrameMs, nowMs() - processStart);
+#else
+    (void)processStart;
+#endif
+
+    // frame_cpu: the per-frame work a game loop does besides waiting
+    std::vector<double> frameMs;
+    for (int i = 0; i < options.frames; i++) {
+        double start = nowMs();
+        SimulateFrame(entities, snapshots, jobs, 1.0f / 120.0f);
+#ifdef PROJECT4_BENCH_GL
+        glClear(GL_COLOR_BUFFER_BIT);
+        commands.clear();
+        batch.record(commands, 0, snapshots.getFront(), 0.0f);
+        commands.sort();
+        commands.execute();
+        batch.fence();
+        window.swapBuffers();
+#endif
+        frameMs.push_back(nowMs() - start);
+    }
+    fprintf(out, "  \"frame_cpu\": {\"entities\": %d, \"frames\": %d, \"gl\": %s, ",
+        entities.getCount(), options.frames,
+#ifdef PROJECT4_BENCH_GL
+        "true"
+#else
+        "false"
+#endif
+    );
+    WriteTimes(out, Summarize(frameMs));
+    fprintf(out, "},\n");
+
+#ifdef PROJECT4_BENCH_GL
+    batch.destroy();
+    window.terminate();
+#endif
+    jobs.shutdown();
+
+    BenchBulkMath(out, options.elements);
+
+    // pacing last, nothing else competes for the core by then
+    fprintf(out, "  \"pacing\": [\n");
+    const double rates[] = { 60.0, 144.0 };
+    for (double fps : rates) {
+        BenchPacing(out, GameClock::SLEEP_SPIN, "sleep_spin", fps, options.frames, false);
+        BenchPacing(out, GameClock::BUSY_WAIT, "busy_wait", fps, options.frames, fps == rates[1]);
+    }
+    fprintf(out, "  ]\n}\n");
+
+    if (out != stdout) fclose(out);
+    return 0;
+}
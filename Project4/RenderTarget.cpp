@@ -0,0 +1,69 @@
+#include "RenderTarget.h"
+
+#include <stdio.h>
+
+int RenderTarget::init(int width, int height, GLenum colorFormat, bool withDepth) {
+	this->width = width;
+	this->height = height;
+	this->colorFormat = colorFormat;
+
+	glGenRenderbuffers(1, &color);
+	if (withDepth) glGenRenderbuffers(1, &depth);
+	allocate();
+
+	glGenFramebuffers(1, &fbo);
+	glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color);
+	if (depth) glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depth);
+
+	GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	if (status != GL_FRAMEBUFFER_COMPLETE) {
+		printf("Framebuffer incomplete (Status: 0x%x)\n", status);
+		return 1;
+	}
+	return 0;
+}
+
+void RenderTarget::allocate() {
+	glBindRenderbuffer(GL_RENDERBUFFER, color);
+	glRenderbufferStorage(GL_RENDERBUFFER, colorFormat, width, height);
+	if (depth) {
+		glBindRenderbuffer(GL_RENDERBUFFER, depth);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+	}
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+}
+
+void RenderTarget::destroy() {
+	if (fbo) glDeleteFramebuffers(1, &fbo);
+	if (color) glDeleteRenderbuffers(1, &color);
+	if (depth) glDeleteRenderbuffers(1, &depth);
+	fbo = color = depth = 0;
+}
+
+bool RenderTarget::resize(int width, int height) {
+	if (width == this->width && height == this->height) return false;
+	// a minimized window reports 0x0, keep the old storage until it's back
+	if (width <= 0 || height <= 0) return false;
+
+	this->width = width;
+	this->height = height;
+	allocate();
+	return true;
+}
+
+void RenderTarget::bind() {
+	glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+}
+
+GLuint RenderTarget::getId() {
+	return fbo;
+}
+
+int RenderTarget::getWidth() {
+	return width;
+}
+
+int RenderTarget::getHeight() {
+	return height;
+}
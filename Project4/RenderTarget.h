@@ -0,0 +1,31 @@
+#pragma once
+
+#include <GL/glew.h>
+
+// Framebuffer with a color (and optionally depth/stencil) renderbuffer.
+// resize() re-specifies the storage of the existing renderbuffers, so the
+// GL object names stay valid and the old storage is released by the
+// driver; nothing is reallocated when the size did not change.
+class RenderTarget {
+private:
+	GLuint fbo = 0;
+	GLuint color = 0;
+	GLuint depth = 0;
+	GLenum colorFormat = GL_RGBA8;
+	int width = 0;
+	int height = 0;
+
+	void allocate();
+
+public:
+	int init(int width, int height, GLenum colorFormat, bool withDepth);
+	void destroy();
+
+	// returns true if the storage was re-created
+	bool resize(int width, int height);
+	void bind();
+
+	GLuint getId();
+	int getWidth();
+	int getHeight();
+};
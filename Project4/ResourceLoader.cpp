@@ -0,0 +1,164 @@
+#include "ResourceLoader.h"
+#include "GameWindow.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+ResourceLoader::~ResourceLoader() {
+	destroy();
+}
+
+int ResourceLoader::init(GameWindow& window, ShaderCache* cache) {
+	GLFWwindow* share = window.getHandle();
+	this->cache = cache;
+
+	// same context type as the game window, windows can only be created
+	// on the main thread
+	glfwDefaultWindowHints();
+	glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+	glfwWindowHint(GLFW_CONTEXT_CREATION_API, glfwGetWindowAttrib(share, GLFW_CONTEXT_CREATION_API));
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, glfwGetWindowAttrib(share, GLFW_CONTEXT_VERSION_MAJOR));
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, glfwGetWindowAttrib(share, GLFW_CONTEXT_VERSION_MINOR));
+	glfwWindowHint(GLFW_OPENGL_PROFILE, glfwGetWindowAttrib(share, GLFW_OPENGL_PROFILE));
+	glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, glfwGetWindowAttrib(share, GLFW_OPENGL_FORWARD_COMPAT));
+
+	context = glfwCreateWindow(1, 1, "loader", NULL, share);
+	glfwDefaultWindowHints();
+	if (!context) {
+		printf("Error creating the loader context!\n");
+		return 1;
+	}
+
+	running = true;
+	worker = std::thread(&ResourceLoader::workerLoop, this);
+	return 0;
+}
+
+void ResourceLoader::destroy() {
+	if (!context) return;
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		running = false;
+		for (Task& task : tasks)
+			task.request->done = true; // no fence, poll() reports FAILED
+		tasks.clear();
+	}
+	wake.notify_one();
+	worker.join();
+
+	glfwDestroyWindow(context);
+	context = nullptr;
+}
+
+void ResourceLoader::push(Task& task) {
+	task.request->name = 0;
+	task.request->fence = nullptr;
+	task.request->done = false;
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		tasks.push_back(std::move(task));
+	}
+	wake.notify_one();
+}
+
+void ResourceLoader::uploadBuffer(Request& request, GLenum target, const void* data, size_t size, GLenum usage) {
+	Task task;
+	task.type = Task::BUFFER;
+	task.request = &request;
+	task.target = target;
+	task.usage = usage;
+	task.data.resize(size);
+	memcpy(task.data.data(), data, size);
+	push(task);
+}
+
+void ResourceLoader::buildProgram(Request& request, const char* vert, const char* frag) {
+	Task task;
+	task.type = Task::PROGRAM;
+	task.request = &request;
+	task.target = 0;
+	task.usage = 0;
+	task.vert = vert;
+	task.frag = frag;
+	push(task);
+}
+
+// Takes every queued request at once so a batch of programs is submitted
+// to the compiler together, then polls the builds in flight every
+// millisecond until they are done.
+void ResourceLoader::workerLoop() {
+	glfwMakeContextCurrent(context);
+	compiler.init(cache);
+
+	while (true) {
+		std::deque<Task> batch;
+		{
+			std::unique_lock<std::mutex> guard(lock);
+			auto ready = [this] { return !running || !tasks.empty(); };
+			if (building.empty()) wake.wait(guard, ready);
+			else wake.wait_for(guard, std::chrono::milliseconds(1), ready);
+			if (!running) break;
+
+			batch.swap(tasks);
+		}
+
+		for (Task& task : batch)
+			run(task);
+		// starts the compiles submitted above
+		if (!batch.empty()) glFlush();
+
+		for (size_t i = 0; i < building.size();) {
+			if (compiler.poll(building[i].handle) == ShaderCompiler::PENDING) {
+				i++;
+				continue;
+			}
+			complete(*building[i].request, compiler.take(building[i].handle));
+			building.erase(building.begin() + i);
+		}
+		if (building.empty()) compiler.clear();
+	}
+
+	for (Building& build : building)
+		build.request->done = true; // no fence, poll() reports FAILED
+	building.clear();
+	compiler.clear();
+	glfwMakeContextCurrent(NULL);
+}
+
+void ResourceLoader::run(Task& task) {
+	if (task.type == Task::PROGRAM) {
+		Building build = { compiler.submit(task.vert.c_str(), task.frag.c_str()), task.request };
+		building.push_back(build);
+		return;
+	}
+
+	GLuint name = 0;
+	glGenBuffers(1, &name);
+	glBindBuffer(task.target, name);
+	glBufferData(task.target, (GLsizeiptr)task.data.size(), task.data.data(), task.usage);
+	glBindBuffer(task.target, 0);
+	complete(*task.request, name);
+}
+
+void ResourceLoader::complete(Request& request, GLuint name) {
+	// the flush makes the fence visible to the render context
+	request.name = name;
+	request.fence = name ? glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0) : nullptr;
+	glFlush();
+	request.done = true;
+}
+
+ResourceLoader::Status ResourceLoader::poll(Request& request) {
+	if (!request.done) return PENDING;
+	if (!request.fence) return request.name ? READY : FAILED;
+
+	GLenum result = glClientWaitSync(request.fence, 0, 0);
+	if (result == GL_TIMEOUT_EXPIRED) return PENDING;
+
+	glDeleteSync(request.fence);
+	request.fence = nullptr;
+	if (result == GL_WAIT_FAILED) return FAILED;
+	return READY;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ShaderCompiler.h"
+
+class GameWindow;
+class ShaderCache;
+
+// Uploads buffers and builds programs on a worker thread with its own
+// hidden context shared with the game window. Every finished request is
+// followed by a fence and a flush; the render thread polls that fence
+// without waiting, so loading never blocks a frame. Programs go through
+// a ShaderCompiler and compile in parallel where the driver allows it.
+//
+// Buffers and programs are shared between the contexts, VAOs are not:
+// build those on the render thread once the request is ready, and bind
+// the buffer there again before use so the uploaded data is visible.
+class ResourceLoader {
+public:
+	enum Status { PENDING, READY, FAILED };
+
+	// owned by the caller, must stay alive until poll() stops returning PENDING
+	struct Request {
+		GLuint name = 0; // buffer or program, valid once READY
+		std::atomic<bool> done{ false };
+		GLsync fence = nullptr;
+	};
+
+private:
+	struct Task {
+		enum Type { BUFFER, PROGRAM };
+
+		Type type;
+		Request* request;
+		GLenum target;
+		GLenum usage;
+		std::vector<char> data;
+		std::string vert;
+		std::string frag;
+	};
+
+	// program in flight on the compiler
+	struct Building {
+		int handle;
+		Request* request;
+	};
+
+	GLFWwindow* context = nullptr;
+	ShaderCache* cache = nullptr;
+	std::thread worker;
+	std::mutex lock;
+	std::condition_variable wake;
+	std::deque<Task> tasks;
+	bool running = false;
+
+	// worker thread only
+	ShaderCompiler compiler;
+	std::vector<Building> building;
+
+	void workerLoop();
+	void run(Task& task);
+	void complete(Request& request, GLuint name);
+	void push(Task& task);
+
+public:
+	~ResourceLoader();
+
+	// call on the main thread after window.init(); cache may be NULL
+	int init(GameWindow& window, ShaderCache* cache);
+	// drops queued requests, must run on the main thread
+	void destroy();
+
+	// data is copied, the caller may free it right away
+	void uploadBuffer(Request& request, GLenum target, const void* data, size_t size, GLenum usage);
+	void buildProgram(Request& request, const char* vert, const char* frag);
+
+	// render thread; never blocks
+	Status poll(Request& request);
+};
@@ -0,0 +1,134 @@
+#include "Shader.h"
+#include "ShaderCache.h"
+#include "ShaderCompiler.h"
+
+#include <stdio.h>
+#include <string.h>
+
+GLuint ProgramState::currentProgram = 0;
+GLuint ProgramState::currentVAO = 0;
+
+void ProgramState::useProgram(GLuint program) {
+	if (program == currentProgram) return;
+	glUseProgram(program);
+	currentProgram = program;
+}
+
+void ProgramState::bindVertexArray(GLuint vao) {
+	if (vao == currentVAO) return;
+	glBindVertexArray(vao);
+	currentVAO = vao;
+}
+
+void ProgramState::invalidate() {
+	glUseProgram(0);
+	glBindVertexArray(0);
+	currentProgram = 0;
+	currentVAO = 0;
+}
+
+// compile, link and validate; returns 0 on failure
+GLuint Shader::buildProgram(const char* vert, const char* frag) {
+	return ShaderCompiler::build(vert, frag);
+}
+
+int Shader::compile(const char* vert, const char* frag, ShaderCache* cache) {
+	GLuint program = cache ? cache->getProgram(vert, frag, buildProgram) : buildProgram(vert, frag);
+	if (!program) return 1;
+	return adopt(program);
+}
+
+// takes ownership of an already linked program
+int Shader::adopt(GLuint program) {
+	destroy();
+	programId = program;
+	cacheUniforms();
+	return 0;
+}
+
+void Shader::destroy() {
+	if (!programId) return;
+	glDeleteProgram(programId);
+	programId = 0;
+	uniforms.clear();
+	uniformIndex.clear();
+}
+
+// Reads every active uniform once after linking, so frames only do a
+// vector lookup instead of glGetUniformLocation.
+void Shader::cacheUniforms() {
+	GLint count = 0;
+	glGetProgramiv(programId, GL_ACTIVE_UNIFORMS, &count);
+
+	for (GLint i = 0; i < count; i++) {
+		GLchar name[256];
+		GLsizei length = 0;
+		GLint size = 0;
+		GLenum type = 0;
+		glGetActiveUniform(programId, i, sizeof(name), &length, &size, &type, name);
+
+		// arrays are reported as "name[0]"
+		std::string key(name, length);
+		if (key.size() > 3 && key.compare(key.size() - 3, 3, "[0]") == 0)
+			key.resize(key.size() - 3);
+
+		Uniform uniform;
+		uniform.location = glGetUniformLocation(programId, name);
+		uniform.type = type;
+		uniform.uploaded = false;
+		memset(&uniform.value, 0, sizeof(uniform.value));
+		if (uniform.location < 0) continue; // uniform block members
+
+		uniformIndex[key] = (int)uniforms.size();
+		uniforms.push_back(uniform);
+	}
+}
+
+// true if the upload has to happen; also updates the shadow copy
+bool Shader::changed(int uniform, const void* value, size_t size) {
+	if (uniform < 0 || uniform >= (int)uniforms.size()) return false;
+
+	Uniform& slot = uniforms[uniform];
+	if (slot.uploaded && memcmp(&slot.value, value, size) == 0) return false;
+
+	memcpy(&slot.value, value, size);
+	slot.uploaded = true;
+	ProgramState::useProgram(programId);
+	return true;
+}
+
+void Shader::use() {
+	ProgramState::useProgram(programId);
+}
+
+GLuint Shader::getId() {
+	return programId;
+}
+
+int Shader::getUniform(const std::string& name) {
+	std::unordered_map<std::string, int>::iterator it = uniformIndex.find(name);
+	if (it == uniformIndex.end()) return -1;
+	return it->second;
+}
+
+void Shader::setInt(int uniform, GLint value) {
+	if (changed(uniform, &value, sizeof(value)))
+		glUniform1i(uniforms[uniform].location, value);
+}
+
+void Shader::setFloat(int uniform, GLfloat value) {
+	if (changed(uniform, &value, sizeof(value)))
+		glUniform1f(uniforms[uniform].location, value);
+}
+
+void Shader::setVec2(int uniform, GLfloat x, GLfloat y) {
+	GLfloat value[2] = { x, y };
+	if (changed(uniform, value, sizeof(value)))
+		glUniform2f(uniforms[uniform].location, x, y);
+}
+
+void Shader::setVec4(int uniform, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	GLfloat value[4] = { x, y, z, w };
+	if (changed(uniform, value, sizeof(value)))
+		glUniform4f(uniforms[uniform].location, x, y, z, w);
+}
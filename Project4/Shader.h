@@ -0,0 +1,61 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class ShaderCache;
+
+// Shadows the bound program and VAO so repeated binds are skipped.
+// Code that binds through raw GL calls must call invalidate() after.
+class ProgramState {
+private:
+	static GLuint currentProgram;
+	static GLuint currentVAO;
+
+public:
+	static void useProgram(GLuint program);
+	static void bindVertexArray(GLuint vao);
+	static void invalidate();
+};
+
+class Shader {
+private:
+	// active uniform with the last value uploaded to it
+	struct Uniform {
+		GLint location;
+		GLenum type;
+		bool uploaded;
+		union {
+			GLfloat f[4];
+			GLint i[4];
+		} value;
+	};
+
+	GLuint programId = 0;
+	std::vector<Uniform> uniforms;
+	std::unordered_map<std::string, int> uniformIndex;
+
+	void cacheUniforms();
+	bool changed(int uniform, const void* value, size_t size);
+
+public:
+	static GLuint buildProgram(const char* vert, const char* frag);
+
+	// cache may be NULL; returns 0 on success like GameWindow::init
+	int compile(const char* vert, const char* frag, ShaderCache* cache);
+	int adopt(GLuint program);
+	void destroy();
+
+	void use();
+	GLuint getId();
+
+	// handle for the set* calls, -1 if the uniform isn't active
+	int getUniform(const std::string& name);
+
+	void setInt(int uniform, GLint value);
+	void setFloat(int uniform, GLfloat value);
+	void setVec2(int uniform, GLfloat x, GLfloat y);
+	void setVec4(int uniform, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
+};
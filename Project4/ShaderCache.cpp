@@ -0,0 +1,212 @@
+#include "ShaderCache.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+// header in front of every cached binary
+struct CacheHeader {
+	unsigned int magic;
+	unsigned int version;
+	unsigned long long key;
+	unsigned int format;
+	unsigned int length;
+};
+
+static const unsigned int CACHE_MAGIC = 0x42504c47; // "GLPB"
+static const unsigned int CACHE_VERSION = 1;
+
+// FNV-1a 64
+static unsigned long long hashBytes(const char* data, size_t size, unsigned long long hash) {
+	for (size_t i = 0; i < size; i++) {
+		hash ^= (unsigned char)data[i];
+		hash *= 0x100000001b3ULL;
+	}
+	return hash;
+}
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+ShaderCache::ShaderCache(const std::string& directory) :
+	directory(directory)
+{ }
+
+void ShaderCache::initialize() {
+	initialized = true;
+
+	GLint formats = 0;
+	if (GLEW_ARB_get_program_binary)
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+	supported = formats > 0;
+	if (!supported) {
+		printf("Shader cache disabled: no program binary formats\n");
+		return;
+	}
+
+	driver = (const char*)glGetString(GL_VENDOR);
+	driver += '|';
+	driver += (const char*)glGetString(GL_RENDERER);
+	driver += '|';
+	driver += (const char*)glGetString(GL_VERSION);
+
+#ifdef _WIN32
+	_mkdir(directory.c_str());
+#else
+	mkdir(directory.c_str(), 0755);
+#endif
+}
+
+unsigned long long ShaderCache::makeKey(const char* vert, const char* frag) {
+	unsigned long long key = 0xcbf29ce484222325ULL;
+	key = hashBytes(driver.c_str(), driver.size() + 1, key);
+	key = hashBytes(vert, strlen(vert) + 1, key);
+	key = hashBytes(frag, strlen(frag) + 1, key);
+	return key;
+}
+
+std::string ShaderCache::pathFor(unsigned long long key) {
+	char name[32];
+	snprintf(name, sizeof(name), "%016llx.bin", key);
+	return directory + "/" + name;
+}
+
+bool ShaderCache::load(unsigned long long key, GLuint& program) {
+	FILE* file = fopen(pathFor(key).c_str(), "rb");
+	if (!file) return false;
+
+	// a truncated or corrupt file is a miss, its length is checked
+	// against the file before anything is allocated for it
+	long size = -1;
+	if (fseek(file, 0, SEEK_END) == 0) size = ftell(file);
+	rewind(file);
+
+	CacheHeader header;
+	std::vector<char> binary;
+	bool valid = size >= (long)sizeof(header)
+		&& fread(&header, sizeof(header), 1, file) == 1
+		&& header.magic == CACHE_MAGIC
+		&& header.version == CACHE_VERSION
+		&& header.key == key
+		&& header.length > 0
+		&& (unsigned long)header.length == (unsigned long)size - sizeof(header);
+	if (valid) {
+		binary.resize(header.length);
+		valid = fread(binary.data(), 1, binary.size(), file) == binary.size();
+	}
+	fclose(file);
+	if (!valid) return false;
+
+	program = glCreateProgram();
+	glProgramBinary(program, header.format, binary.data(), (GLsizei)binary.size());
+
+	// the driver rejects binaries it no longer understands
+	GLint result = 0;
+	glGetProgramiv(program, GL_LINK_STATUS, &result);
+	if (!result) {
+		glDeleteProgram(program);
+		program = 0;
+		return false;
+	}
+	return true;
+}
+
+void ShaderCache::store(unsigned long long key, GLuint program) {
+	GLint length = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0) return;
+
+	std::vector<char> binary(length);
+	GLenum format = 0;
+	glGetProgramBinary(program, length, NULL, &format, binary.data());
+
+	FILE* file = fopen(pathFor(key).c_str(), "wb");
+	if (!file) {
+		printf("Can't write shader cache '%s'!\n", pathFor(key).c_str());
+		return;
+	}
+
+	CacheHeader header = { CACHE_MAGIC, CACHE_VERSION, key, format, (unsigned int)length };
+	fwrite(&header, sizeof(header), 1, file);
+	fwrite(binary.data(), 1, binary.size(), file);
+	fclose(file);
+}
+
+GLuint ShaderCache::getProgram(const char* vert, const char* frag, BuildFunc build) {
+	std::lock_guard<std::mutex> guard(lock);
+	if (!initialized) initialize();
+	if (!supported) return build(vert, frag);
+
+	auto start = std::chrono::steady_clock::now();
+	unsigned long long key = makeKey(vert, frag);
+
+	GLuint program = 0;
+	if (load(key, program)) {
+		double ms = elapsedMs(start);
+		stats.hits++;
+		stats.hitMs += ms;
+		printf("Shader cache hit %016llx (%.2f ms)\n", key, ms);
+		return program;
+	}
+
+	program = build(vert, frag);
+	if (program) store(key, program);
+
+	double ms = elapsedMs(start);
+	stats.misses++;
+	stats.missMs += ms;
+	printf("Shader cache miss %016llx (%.2f ms)\n", key, ms);
+	return program;
+}
+
+GLuint ShaderCache::find(const char* vert, const char* frag) {
+	std::lock_guard<std::mutex> guard(lock);
+	if (!initialized) initialize();
+	if (!supported) return 0;
+
+	auto start = std::chrono::steady_clock::now();
+	unsigned long long key = makeKey(vert, frag);
+
+	GLuint program = 0;
+	if (!load(key, program)) {
+		stats.misses++;
+		return 0;
+	}
+
+	double ms = elapsedMs(start);
+	stats.hits++;
+	stats.hitMs += ms;
+	printf("Shader cache hit %016llx (%.2f ms)\n", key, ms);
+	return program;
+}
+
+// the compile time of these is unknown here, missMs only gets the store
+void ShaderCache::insert(const char* vert, const char* frag, GLuint program) {
+	std::lock_guard<std::mutex> guard(lock);
+	if (!initialized) initialize();
+	if (!supported) return;
+
+	auto start = std::chrono::steady_clock::now();
+	unsigned long long key = makeKey(vert, frag);
+	store(key, program);
+	stats.missMs += elapsedMs(start);
+}
+
+bool ShaderCache::isSupported() {
+	std::lock_guard<std::mutex> guard(lock);
+	if (!initialized) initialize();
+	return supported;
+}
+
+ShaderCache::Stats ShaderCache::getStats() {
+	std::lock_guard<std::mutex> guard(lock);
+	return stats;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <mutex>
+#include <string>
+
+// Persists linked programs with glGetProgramBinary, keyed by a hash of
+// the shader sources and the driver string, so later launches can skip
+// compiling. Any mismatch falls back to a full compile.
+class ShaderCache {
+public:
+	typedef GLuint (*BuildFunc)(const char* vert, const char* frag);
+
+	struct Stats {
+		int hits;
+		int misses;
+		double hitMs;  // total time spent loading binaries
+		double missMs; // total time spent compiling + storing
+	};
+
+private:
+	std::string directory;
+	std::string driver;
+	bool supported = false;
+	bool initialized = false;
+	Stats stats = { 0, 0, 0.0, 0.0 };
+	std::mutex lock; // the loader thread builds programs too
+
+	void initialize();
+	unsigned long long makeKey(const char* vert, const char* frag);
+	std::string pathFor(unsigned long long key);
+	bool load(unsigned long long key, GLuint& program);
+	void store(unsigned long long key, GLuint program);
+
+public:
+	ShaderCache(const std::string& directory);
+
+	// needs a current context, any thread; returns 0 if the program failed to build
+	GLuint getProgram(const char* vert, const char* frag, BuildFunc build);
+
+	// split form of getProgram for builds that finish later (ShaderCompiler):
+	// find() returns 0 on a miss, insert() stores a freshly linked program
+	GLuint find(const char* vert, const char* frag);
+	void insert(const char* vert, const char* frag, GLuint program);
+
+	bool isSupported();
+	Stats getStats();
+};
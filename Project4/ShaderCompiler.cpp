@@ -0,0 +1,181 @@
+#include "ShaderCompiler.h"
+#include "ShaderCache.h"
+
+#include <stdio.h>
+#include <string.h>
+
+void ShaderCompiler::init(ShaderCache* cache) {
+	this->cache = cache;
+
+	// let the driver use as many compiler threads as it likes
+	if (GLEW_KHR_parallel_shader_compile) {
+		glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+		parallel = true;
+	}
+	else if (GLEW_ARB_parallel_shader_compile) {
+		glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+		parallel = true;
+	}
+}
+
+GLuint ShaderCompiler::compileStage(const char* code, GLenum type) {
+	GLuint shader = glCreateShader(type);
+
+	const GLchar* shaderCode[1];
+	shaderCode[0] = code;
+
+	GLint codeLength[1];
+	codeLength[0] = (GLint)strlen(code);
+
+	glShaderSource(shader, 1, shaderCode, codeLength);
+	glCompileShader(shader);
+	return shader;
+}
+
+// Checks a submitted program and releases its stages. The link status
+// is the only query on success; logs are read only when it failed.
+bool ShaderCompiler::finish(GLuint program, GLuint vert, GLuint frag) {
+	GLint result = 0;
+	GLchar errorLog[1024] = { 0 };
+
+	glGetProgramiv(program, GL_LINK_STATUS, &result);
+	if (!result) {
+		GLuint stages[2] = { vert, frag };
+		for (GLuint stage : stages) {
+			GLint compiled = 0;
+			glGetShaderiv(stage, GL_COMPILE_STATUS, &compiled);
+			if (compiled) continue;
+
+			GLint type = 0;
+			glGetShaderiv(stage, GL_SHADER_TYPE, &type);
+			glGetShaderInfoLog(stage, sizeof(errorLog), NULL, errorLog);
+			printf("Error compiling shader '%d': '%s'\n", type, errorLog);
+		}
+
+		glGetProgramInfoLog(program, sizeof(errorLog), NULL, errorLog);
+		printf("Error linking program: '%s'\n", errorLog);
+	}
+
+	// the stages are only needed for their logs
+	glDetachShader(program, vert);
+	glDetachShader(program, frag);
+	glDeleteShader(vert);
+	glDeleteShader(frag);
+	if (!result) return false;
+
+	glValidateProgram(program);
+	glGetProgramiv(program, GL_VALIDATE_STATUS, &result);
+	if (!result) {
+		glGetProgramInfoLog(program, sizeof(errorLog), NULL, errorLog);
+		printf("Error validating program: '%s'\n", errorLog);
+		return false;
+	}
+	return true;
+}
+
+int ShaderCompiler::submit(const char* vert, const char* frag) {
+	Build build;
+	build.status = PENDING;
+
+	if (cache) {
+		build.program = cache->find(vert, frag);
+		if (build.program) {
+			build.vert = build.frag = 0;
+			build.status = READY;
+			builds.push_back(build);
+			return (int)builds.size() - 1;
+		}
+		build.vertSource = vert;
+		build.fragSource = frag;
+	}
+
+	build.program = glCreateProgram();
+	if (!build.program) {
+		printf("Error creating shader program!\n");
+		build.vert = build.frag = 0;
+		build.status = FAILED;
+		builds.push_back(build);
+		return (int)builds.size() - 1;
+	}
+
+	build.vert = compileStage(vert, GL_VERTEX_SHADER);
+	build.frag = compileStage(frag, GL_FRAGMENT_SHADER);
+	glAttachShader(build.program, build.vert);
+	glAttachShader(build.program, build.frag);
+
+	// lets the shader cache read the linked binary back
+	if (GLEW_ARB_get_program_binary)
+		glProgramParameteri(build.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+	// linking right away queues it behind the compiles on the driver side
+	glLinkProgram(build.program);
+
+	builds.push_back(build);
+	return (int)builds.size() - 1;
+}
+
+void ShaderCompiler::complete(Build& build) {
+	if (!finish(build.program, build.vert, build.frag)) {
+		glDeleteProgram(build.program);
+		build.program = 0;
+		build.status = FAILED;
+		return;
+	}
+
+	if (cache) cache->insert(build.vertSource.c_str(), build.fragSource.c_str(), build.program);
+	build.vertSource.clear();
+	build.fragSource.clear();
+	build.status = READY;
+}
+
+ShaderCompiler::Status ShaderCompiler::poll(int handle) {
+	Build& build = builds[handle];
+	if (build.status != PENDING) return build.status;
+
+	if (parallel) {
+		GLint done = 0;
+		glGetProgramiv(build.program, GL_COMPLETION_STATUS_KHR, &done);
+		if (!done) return PENDING;
+	}
+
+	complete(build);
+	return build.status;
+}
+
+int ShaderCompiler::pollAll() {
+	int pending = 0;
+	for (int i = 0; i < (int)builds.size(); i++)
+		if (poll(i) == PENDING) pending++;
+	return pending;
+}
+
+GLuint ShaderCompiler::take(int handle) {
+	Build& build = builds[handle];
+	if (build.status != READY) return 0;
+
+	GLuint program = build.program;
+	build.program = 0;
+	return program;
+}
+
+void ShaderCompiler::clear() {
+	for (Build& build : builds) {
+		if (build.status == PENDING) {
+			glDeleteShader(build.vert);
+			glDeleteShader(build.frag);
+		}
+		if (build.program) glDeleteProgram(build.program);
+	}
+	builds.clear();
+}
+
+bool ShaderCompiler::isParallel() {
+	return parallel;
+}
+
+GLuint ShaderCompiler::build(const char* vert, const char* frag) {
+	ShaderCompiler compiler;
+	int handle = compiler.submit(vert, frag);
+	compiler.poll(handle);
+	return compiler.take(handle);
+}
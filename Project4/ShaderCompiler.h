@@ -0,0 +1,57 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <string>
+#include <vector>
+
+class ShaderCache;
+
+// Builds programs in batches. submit() only issues the compile and link
+// commands; nothing asks the driver for a result until poll(), so with
+// GL_KHR_parallel_shader_compile the stages compile on the driver's
+// threads while the caller carries on. Without the extension the first
+// status query blocks, but the driver still sees every program before
+// it has to finish one. Info logs are only read for failed programs.
+class ShaderCompiler {
+public:
+	enum Status { PENDING, READY, FAILED };
+
+private:
+	struct Build {
+		GLuint program;
+		GLuint vert;
+		GLuint frag;
+		Status status;
+		// kept to store the binary once linked, only with a cache
+		std::string vertSource;
+		std::string fragSource;
+	};
+
+	std::vector<Build> builds;
+	ShaderCache* cache = nullptr;
+	bool parallel = false;
+
+	static GLuint compileStage(const char* code, GLenum type);
+	static bool finish(GLuint program, GLuint vert, GLuint frag);
+	void complete(Build& build);
+
+public:
+	// needs a current context; cache may be NULL
+	void init(ShaderCache* cache);
+
+	// returns a handle for poll() and take()
+	int submit(const char* vert, const char* frag);
+	// never blocks with parallel compile support
+	Status poll(int handle);
+	// polls every build, returns how many are still pending
+	int pollAll();
+	// hands over a READY program, e.g. to Shader::adopt; 0 otherwise
+	GLuint take(int handle);
+	// forgets all builds, deleting programs nobody took
+	void clear();
+
+	bool isParallel();
+
+	// compile, link and validate right away; returns 0 on failure
+	static GLuint build(const char* vert, const char* frag);
+};
@@ -0,0 +1,112 @@
+#include "ShaderReloader.h"
+#include "Shader.h"
+#include "ShaderSource.h"
+
+#include <stdio.h>
+#include <algorithm>
+
+int ShaderReloader::init() {
+	// reloads are throwaway builds, they don't go into the shader cache
+	compiler.init(NULL);
+	return watcher.init();
+}
+
+void ShaderReloader::destroy() {
+	compiler.clear();
+	watcher.destroy();
+	programs.clear();
+}
+
+void ShaderReloader::add(Shader& shader, const std::string& vertPath, const std::string& fragPath, const ReloadFunc& onReload) {
+	Program program;
+	program.shader = &shader;
+	program.vertPath = vertPath;
+	program.fragPath = fragPath;
+	program.onReload = onReload;
+	program.build = -1;
+	program.dirty = false;
+
+	std::string source;
+	std::vector<std::string> fragFiles;
+	bool loaded = ShaderSource::load(vertPath, source, program.files);
+	loaded = ShaderSource::load(fragPath, source, fragFiles) && loaded;
+	program.files.insert(program.files.end(), fragFiles.begin(), fragFiles.end());
+
+	// the entry files stay watched even when they can't be read, fixing
+	// them later still triggers a rebuild
+	if (!loaded) {
+		printf("Can't load '%s' + '%s', rebuilding once they can be read\n", vertPath.c_str(), fragPath.c_str());
+		if (std::find(program.files.begin(), program.files.end(), vertPath) == program.files.end())
+			program.files.push_back(vertPath);
+		if (std::find(program.files.begin(), program.files.end(), fragPath) == program.files.end())
+			program.files.push_back(fragPath);
+	}
+
+	for (const std::string& file : program.files)
+		watcher.watch(file);
+	programs.push_back(program);
+}
+
+void ShaderReloader::submit(Program& program) {
+	std::string vert, frag;
+	std::vector<std::string> vertFiles, fragFiles;
+	if (!ShaderSource::load(program.vertPath, vert, vertFiles) || !ShaderSource::load(program.fragPath, frag, fragFiles))
+		return;
+
+	// includes may have been added or removed
+	program.files = vertFiles;
+	program.files.insert(program.files.end(), fragFiles.begin(), fragFiles.end());
+	for (const std::string& file : program.files)
+		watcher.watch(file);
+
+	program.build = compiler.submit(vert.c_str(), frag.c_str());
+}
+
+int ShaderReloader::update() {
+	changed.clear();
+	if (watcher.poll(changed)) {
+		for (Program& program : programs) {
+			for (const std::string& file : changed) {
+				if (std::find(program.files.begin(), program.files.end(), file) == program.files.end()) continue;
+				if (program.build >= 0) program.dirty = true; // built again once this one is done
+				else submit(program);
+				break;
+			}
+		}
+	}
+
+	int swapped = 0;
+	bool building = false;
+	for (Program& program : programs) {
+		if (program.build < 0) continue;
+
+		ShaderCompiler::Status status = compiler.poll(program.build);
+		if (status == ShaderCompiler::PENDING) {
+			building = true;
+			continue;
+		}
+
+		if (status == ShaderCompiler::READY) {
+			program.shader->adopt(compiler.take(program.build));
+			if (program.onReload) program.onReload();
+			printf("Reloaded '%s' + '%s'\n", program.vertPath.c_str(), program.fragPath.c_str());
+			swapped++;
+		}
+		else {
+			printf("Keeping the previous '%s' + '%s'\n", program.vertPath.c_str(), program.fragPath.c_str());
+		}
+		program.build = -1;
+
+		// a newer edit landed while this one was building
+		if (program.dirty) {
+			program.dirty = false;
+			submit(program);
+			if (program.build >= 0) building = true;
+		}
+	}
+
+	// the old program ids are gone, don't trust the shadowed binding
+	if (swapped) ProgramState::invalidate();
+	if (!building) compiler.clear();
+	return swapped;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "FileWatcher.h"
+#include "ShaderCompiler.h"
+
+class Shader;
+
+// Rebuilds programs whose source files (or anything they #include)
+// changed on disk. update() runs on the thread that owns the context,
+// once per frame: only the affected programs are resubmitted, and each
+// one is swapped in between frames once it links. A program that fails
+// keeps running the previous version.
+class ShaderReloader {
+public:
+	// called after a swap, uniform handles have to be fetched again
+	typedef std::function<void()> ReloadFunc;
+
+private:
+	struct Program {
+		Shader* shader;
+		std::string vertPath;
+		std::string fragPath;
+		std::vector<std::string> files;
+		ReloadFunc onReload;
+		int build; // compiler handle, -1 when idle
+		bool dirty; // changed again while building, resubmitted once it's done
+	};
+
+	FileWatcher watcher;
+	ShaderCompiler compiler;
+	std::vector<Program> programs;
+	std::vector<std::string> changed;
+
+	void submit(Program& program);
+
+public:
+	// needs a current context
+	int init();
+	void destroy();
+
+	// shader must already hold a program built from these files
+	void add(Shader& shader, const std::string& vertPath, const std::string& fragPath, const ReloadFunc& onReload);
+
+	// returns how many programs were swapped
+	int update();
+};
@@ -0,0 +1,63 @@
+#include "ShaderSource.h"
+
+#include <stdio.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+static std::string directoryOf(const std::string& path) {
+	size_t slash = path.find_last_of("/\\");
+	return slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+}
+
+bool ShaderSource::load(const std::string& path, std::string& source, std::vector<std::string>& files) {
+	source.clear();
+	files.clear();
+	return append(path, source, files);
+}
+
+bool ShaderSource::append(const std::string& path, std::string& source, std::vector<std::string>& files) {
+	std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+	if (!file) {
+		printf("Can't read shader '%s'!\n", path.c_str());
+		return false;
+	}
+
+	int index = (int)files.size();
+	files.push_back(path);
+
+	std::string line;
+	int lineNumber = 0;
+	while (std::getline(file, line)) {
+		lineNumber++;
+		if (!line.empty() && line[line.size() - 1] == '\r') line.resize(line.size() - 1);
+
+		size_t start = line.find_first_not_of(" \t");
+		if (start == std::string::npos || line.compare(start, 8, "#include") != 0) {
+			source += line;
+			source += '\n';
+			continue;
+		}
+
+		size_t open = line.find('"', start + 8);
+		size_t close = open == std::string::npos ? open : line.find('"', open + 1);
+		if (close == std::string::npos) {
+			printf("Bad #include in '%s' line %d\n", path.c_str(), lineNumber);
+			return false;
+		}
+
+		std::string included = directoryOf(path) + line.substr(open + 1, close - open - 1);
+		if (std::find(files.begin(), files.end(), included) == files.end()) {
+			std::ostringstream marker;
+			marker << "#line 1 " << files.size() << '\n';
+			source += marker.str();
+			if (!append(included, source, files)) return false;
+		}
+
+		// back to the including file, the line after the #include
+		std::ostringstream marker;
+		marker << "#line " << lineNumber + 1 << ' ' << index << '\n';
+		source += marker.str();
+	}
+	return true;
+}
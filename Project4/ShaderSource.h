@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+// Reads GLSL from files and splices in lines of the form
+//   #include "name"
+// resolved next to the including file. Every file is included once.
+// The spliced text is wrapped in #line directives whose source string
+// number is the file's index in `files`, so compiler errors read as
+// <file index>:<line>.
+class ShaderSource {
+private:
+	static bool append(const std::string& path, std::string& source, std::vector<std::string>& files);
+
+public:
+	// files receives the path itself followed by everything it included;
+	// returns false and prints the path if a file can't be read
+	static bool load(const std::string& path, std::string& source, std::vector<std::string>& files);
+};
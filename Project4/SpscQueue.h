@@ -0,0 +1,38 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+
+// Bounded lock-free queue for exactly one producer and one consumer
+// thread. Capacity must be a power of two. Head and tail live on their
+// own cache lines so the two sides don't false-share.
+template <typename T, size_t Capacity>
+class SpscQueue {
+private:
+	static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+	alignas(64) std::atomic<size_t> head{ 0 }; // next slot to read
+	alignas(64) std::atomic<size_t> tail{ 0 }; // next slot to write
+	T items[Capacity];
+
+public:
+	// producer side, false if the queue is full
+	bool push(const T& item) {
+		size_t writeIndex = tail.load(std::memory_order_relaxed);
+		if (writeIndex - head.load(std::memory_order_acquire) == Capacity) return false;
+
+		items[writeIndex & (Capacity - 1)] = item;
+		tail.store(writeIndex + 1, std::memory_order_release);
+		return true;
+	}
+
+	// consumer side, false if the queue is empty
+	bool pop(T& item) {
+		size_t readIndex = head.load(std::memory_order_relaxed);
+		if (readIndex == tail.load(std::memory_order_acquire)) return false;
+
+		item = items[readIndex & (Capacity - 1)];
+		head.store(readIndex + 1, std::memory_order_release);
+		return true;
+	}
+};
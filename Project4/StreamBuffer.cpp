@@ -0,0 +1,100 @@
+#include "StreamBuffer.h"
+#include "GLRecorder.h"
+
+#include <stdio.h>
+
+int StreamBuffer::init(GLenum target, size_t sectionSize) {
+	this->target = target;
+	this->sectionSize = sectionSize;
+	section = 0;
+
+	size_t totalSize = sectionSize * SECTIONS;
+	glGenBuffers(1, &buffer);
+	glBindBuffer(target, buffer);
+
+	// the recorder captures mapped writes on unmap, persistent maps never unmap
+	persistent = GLEW_ARB_buffer_storage != 0 && !GLRecorder::isRecording();
+	if (persistent) {
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage(target, totalSize, NULL, flags);
+		persistentBase = (char*)glMapBufferRange(target, 0, totalSize, flags);
+		if (!persistentBase) {
+			printf("Persistent mapping failed, falling back to per-frame maps\n");
+			glBindBuffer(target, 0);
+			glDeleteBuffers(1, &buffer);
+			glGenBuffers(1, &buffer);
+			glBindBuffer(target, buffer);
+			persistent = false;
+		}
+	}
+	if (!persistent)
+		glBufferData(target, totalSize, NULL, GL_STREAM_DRAW);
+
+	glBindBuffer(target, 0);
+	return 0;
+}
+
+void StreamBuffer::destroy() {
+	for (int i = 0; i < SECTIONS; i++) {
+		if (fences[i]) glDeleteSync(fences[i]);
+		fences[i] = 0;
+	}
+
+	if (persistentBase) {
+		glBindBuffer(target, buffer);
+		glUnmapBuffer(target);
+		glBindBuffer(target, 0);
+		persistentBase = nullptr;
+	}
+
+	glDeleteBuffers(1, &buffer);
+	buffer = 0;
+}
+
+void StreamBuffer::waitFence(int index) {
+	GLsync sync = fences[index];
+	if (!sync) return;
+
+	// the flush bit makes sure the fence was submitted before we block
+	GLenum result;
+	do {
+		result = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+	} while (result == GL_TIMEOUT_EXPIRED);
+
+	glDeleteSync(sync);
+	fences[index] = 0;
+}
+
+void* StreamBuffer::map(size_t size) {
+	if (size > sectionSize) return nullptr;
+
+	waitFence(section);
+	size_t offset = section * sectionSize;
+	if (persistent) return persistentBase + offset;
+
+	// we fenced this range ourselves, the driver needn't synchronize
+	glBindBuffer(target, buffer);
+	GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT;
+	return glMapBufferRange(target, offset, size, flags);
+}
+
+size_t StreamBuffer::unmap() {
+	if (!persistent) {
+		glUnmapBuffer(target);
+		glBindBuffer(target, 0);
+	}
+	return section * sectionSize;
+}
+
+void StreamBuffer::fence() {
+	fences[section] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	section = (section + 1) % SECTIONS;
+}
+
+GLuint StreamBuffer::getId() {
+	return buffer;
+}
+
+bool StreamBuffer::isPersistent() {
+	return persistent;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <stddef.h>
+
+// Ring of SECTIONS equally sized regions in one buffer for data written
+// by the CPU every frame. Each region is fenced after the draws that
+// read it and only rewritten once the GPU has passed that fence, so the
+// driver never has to stall or shadow-copy on our behalf.
+//
+// With GL_ARB_buffer_storage the whole buffer stays persistently mapped,
+// otherwise each section is mapped unsynchronized + invalidated.
+class StreamBuffer {
+public:
+	static const int SECTIONS = 3;
+
+private:
+	GLenum target = GL_ARRAY_BUFFER;
+	GLuint buffer = 0;
+	size_t sectionSize = 0;
+	int section = 0;
+
+	bool persistent = false;
+	char* persistentBase = nullptr;
+	GLsync fences[SECTIONS] = {};
+
+	void waitFence(int index);
+
+public:
+	int init(GLenum target, size_t sectionSize);
+	void destroy();
+
+	// write pointer into the current section, waits only if the GPU is
+	// still reading it from SECTIONS frames ago
+	void* map(size_t size);
+	// finishes the writes; returns the section's byte offset in the buffer
+	size_t unmap();
+	// call after the draws that read the current section
+	void fence();
+
+	GLuint getId();
+	bool isPersistent();
+};
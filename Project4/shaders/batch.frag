@@ -0,0 +1,7 @@
+#version 330
+
+in vec4 vColour;
+out vec4 colour;
+void main() {
+  colour = vec4(vColour.rgb, 1.0);
+}
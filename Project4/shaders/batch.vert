@@ -0,0 +1,19 @@
+#version 330
+
+#include "velocity.glsl"
+
+layout (location = 0) in vec3 pos;
+layout (location = 1) in float offsetX;
+layout (location = 2) in float offsetY;
+layout (location = 3) in float prevOffsetX;
+layout (location = 4) in float prevOffsetY;
+layout (location = 5) in float velocityX;
+layout (location = 6) in float velocityY;
+uniform float alpha;
+out vec4 vColour;
+
+void main() {
+  vec2 offset = mix(vec2(prevOffsetX, prevOffsetY), vec2(offsetX, offsetY), alpha);
+  gl_Position = vec4(pos.xy + offset, pos.z, 1.0);
+  vColour = velocityColour(vec2(velocityX, velocityY));
+}
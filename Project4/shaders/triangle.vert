@@ -0,0 +1,9 @@
+#version 330
+
+layout (location = 0) in vec3 pos;
+uniform float xMove;
+uniform float yMove;
+
+void main() {
+  gl_Position = vec4(pos.x + xMove, pos.y + yMove, pos.z, 1.0);
+}
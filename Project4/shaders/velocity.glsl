@@ -0,0 +1,4 @@
+// brighter with speed, green/blue channels follow the direction
+vec4 velocityColour(vec2 velocity) {
+  return vec4(1.0, 0.25 + 0.25 * sign(velocity), 1.0) * (0.5 + length(velocity));
+}